@@ -3,74 +3,102 @@
 
 #include <algorithm>
 #include <limits>
+#include <cassert>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace std;
 
 // Fast forward selection, Algorithm 2 in
 // "Scenario Reduction and Scenario Tree Construction for Power Management Problems"
 // Growe-Kuska, Heitsch, Romisch 2003
-// Input: distance matrix, scenario probabilities, total number of scenarios, number of scenarios to pick
+// Input: distances, scenario probabilities, number of scenarios to pick
 // Output: boolean vector, true if scenario is kept, false if scenario is reduced
-static void forwardSelection(double const*const* distances, double const *probabilities, bool* keepingScenario, int nScen, int nReduced) {
+// The matrices c^[i] of the paper are c^[i]_ku = min(d_ku, minDist_k), where
+// minDist_k is the distance from scenario k to the closest kept scenario,
+// so only minDist is stored besides the distances.
+static void forwardSelection(const distributedDistances &distances, double const *probabilities, bool* keepingScenario, int nReduced) {
 	
+	int nScen = distances.nScenarios();
 	fill(keepingScenario, keepingScenario+nScen, false);
 
-	vector<int> added;
-	added.reserve(nReduced);
-
-	// need to store distances from previous step 
-	vector<double> oldC(nScen*nScen), newC(nScen*nScen);
-	for (int i = 0; i < nScen; i++)
-		for (int j = 0; j < nScen; j++) oldC[i*nScen+j] = distances[i][j];
+	int nthreads = 1;
+#ifdef _OPENMP
+	nthreads = omp_get_max_threads();
+#endif
+	vector<double> minDist(nScen, numeric_limits<double>::max());
+	vector<double> score(nScen), threadScore(static_cast<size_t>(nthreads)*nScen);
 
 	for (int i = 0; i < nReduced; i++) {
+		// score_u = sum_k p_k c_ku; the stored d_rk, k < r, contributes
+		// to the scores of both r and k
+		#pragma omp parallel num_threads(nthreads)
+		{
+			int t = 0;
+#ifdef _OPENMP
+			t = omp_get_thread_num();
+#endif
+			double *myScore = &threadScore[static_cast<size_t>(t)*nScen];
+			fill(myScore, myScore+nScen, 0.0);
+			int begin, end;
+			triangleRows(distances.firstRow(), distances.lastRow(), nthreads, t, begin, end);
+			for (int r = begin; r < end; r++) {
+				double const *dr = distances.row(r);
+				double pr = probabilities[r], mr = minDist[r], sr = 0.0;
+				for (int k = 0; k < r; k++) {
+					sr += probabilities[k]*min(dr[k],minDist[k]);
+					myScore[k] += pr*min(dr[k],mr);
+				}
+				myScore[r] += sr;
+			}
+			#pragma omp barrier
+			#pragma omp for schedule(static)
+			for (int u = 0; u < nScen; u++) {
+				double sum = 0.0;
+				for (int q = 0; q < nthreads; q++) sum += threadScore[static_cast<size_t>(q)*nScen+u];
+				score[u] = sum;
+			}
+		}
+		MPI_Allreduce(MPI_IN_PLACE, &score[0], nScen, MPI_DOUBLE, MPI_SUM, distances.comm());
+
 		int minScen = -1;
 		double minVal = numeric_limits<double>::max();
 		for (int u = 0; u < nScen; u++) {
 			if (keepingScenario[u]) continue;
-			double myVal = 0.0;
-			for (int k = 0; k < nScen; k++) {
-				if (keepingScenario[u] || k == u) continue;
-				double val;
-				if (i > 0) {
-					val = min(oldC[k*nScen+u],oldC[k*nScen+added.back()]);
-				} else {
-					val = oldC[k*nScen+u];
-				}
-				newC[k*nScen+u] = val;
-				myVal += probabilities[k]*val;
-			}
-			if (myVal < minVal) {
-				minVal = myVal;
+			if (minScen < 0 || score[u] < minVal) {
+				minVal = score[u];
 				minScen = u;
 			}
 		}
-		newC.swap(oldC);
 		assert(minScen >= 0);
 		assert(!keepingScenario[minScen]);
 		keepingScenario[minScen] = true;
-		added.push_back(minScen);
+		if (i == nReduced-1) break;
+
+		// minDist_k = min(minDist_k, d_k,minScen); the distances to minScen
+		// are in its row and in column minScen of the rows after it
+		vector<double> &update = threadScore;
+		copy(minDist.begin(), minDist.end(), update.begin());
+		update[minScen] = 0.0;
+		if (minScen >= distances.firstRow() && minScen < distances.lastRow()) {
+			double const *ds = distances.row(minScen);
+			for (int k = 0; k < minScen; k++) update[k] = min(update[k],ds[k]);
+		}
+		for (int r = max(minScen+1,distances.firstRow()); r < distances.lastRow(); r++)
+			update[r] = min(update[r],distances.row(r)[minScen]);
+		MPI_Allreduce(&update[0], &minDist[0], nScen, MPI_DOUBLE, MPI_MIN, distances.comm());
 	}
 
-	/*
-	oldC.clear(); newC.clear();
-	vector<vector<distanceScenarioPair> > sortedDistances;
-	sortDistances(distances, nScen, sortedDistances);
-
-	double obj = calculateObjective(sortedDistances, probabilities, keepingScenario);
-	printf("Objective for fast forward selection: %f\n",obj);
-	*/
-
 }
 
 
 
-vector<int> fastForwardSelection(stochasticInput &input, int nScenariosWanted) {
+vector<int> fastForwardSelection(stochasticInput &input, int nScenariosWanted, MPI_Comm comm) {
 	vector<int> out;
 	if (nScenariosWanted == 0) return out;
 
-	double **distances;
-	generateDistances(distances,input);
+	distributedDistances distances(input,comm);
 	int nScen = input.nScenarios();
 	
 	bool *keepingScenario = new bool[nScen];
@@ -78,9 +106,7 @@ vector<int> fastForwardSelection(stochasticInput &input, int nScenariosWanted) {
 	for (int i = 0; i < nScen; i++) probs[i] = input.scenarioProbability(i);
 
 
-	forwardSelection(distances, &probs[0], keepingScenario, nScen, nScenariosWanted);
-
-	freeDistances(distances,input);
+	forwardSelection(distances, &probs[0], keepingScenario, nScenariosWanted);
 
 	for (int i = 0; i < nScen; i++) {
 		if (keepingScenario[i]) out.push_back(i);
@@ -2,8 +2,11 @@
 #define SCENRED_HPP
 
 #include "stochasticInput.hpp"
+#include "mpi.h"
 
-std::vector<int> fastForwardSelection(stochasticInput &input, int nScenariosWanted);
+// the processes of comm share the distance computations and storage and
+// must all call this with the same input
+std::vector<int> fastForwardSelection(stochasticInput &input, int nScenariosWanted, MPI_Comm comm = MPI_COMM_SELF);
 
 
 #endif
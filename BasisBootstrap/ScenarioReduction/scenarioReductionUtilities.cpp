@@ -1,93 +1,109 @@
 #include "scenarioReductionUtilities.hpp"
 #include <algorithm>
 #include <cmath>
+#include <cassert>
+#include <climits>
 
 using namespace std;
 
-void sortDistances(double const*const* distances, int nScen, vector<vector<distanceScenarioPair> > &out) {
-out.resize(nScen);
-	for (int i = 0; i < nScen; i++) {
-		out[i].resize(nScen-1);
-		int pos = 0;
-		for (int j = 0; j < nScen; j++) {
-			if (i == j) continue;
-			out[i][pos].d = distances[i][j];
-			out[i][pos++].scen = j;
-		}
-		sort(out[i].begin(),out[i].end());
-	}
-}
-
-double calculateObjective(const vector<vector<distanceScenarioPair> > &sortedDistances,  
-		double const *probabilities, bool const *keepingScenario) {
-	double obj = 0.0;
-	int nScen = sortedDistances.size();
-	for (int i = 0; i < nScen; i++) {
-		if (keepingScenario[i]) continue;
-		int j;
-		for (j = 0; !keepingScenario[sortedDistances[i][j].scen]; j++);
-		obj += probabilities[i]*sortedDistances[i][j].d;
-	}
-	return obj;	
-
-}
 namespace{
-double vectorDiff2(vector<double> const &v1, vector<double> const &v2) {
+double vectorDiff2(double const *v1, double const *v2, unsigned len) {
 	double sum = 0;
-	for (unsigned i = 0; i < v1.size(); i++) {
+	for (unsigned i = 0; i < len; i++) {
 		double diff = v1[i]-v2[i];
 		sum += diff*diff;
 	}
 	return sum;
 
 }
-double vectorDiff2(double const *v1, double const *v2, unsigned len) {
-	double sum = 0;
-	for (unsigned i = 0; i < len; i++) {
-		double diff = v1[i]-v2[i];
-		sum += diff*diff;
+// the second-stage data of scenario s compared by the distances (the
+// objective is skipped), in one vector
+void scenarioData(stochasticInput &input, int s, vector<double> &out) {
+	vector<double> const &l = input.getSecondStageColLBView(s),
+		&u = input.getSecondStageColUBView(s),
+		&bl = input.getSecondStageRowLBView(s),
+		&bu = input.getSecondStageRowUBView(s);
+	out.assign(l.begin(),l.end());
+	out.insert(out.end(),u.begin(),u.end());
+	out.insert(out.end(),bl.begin(),bl.end());
+	out.insert(out.end(),bu.begin(),bu.end());
+	if (!input.onlyBoundsVary()) {
+		const CoinPackedMatrix &t = input.getLinkingConstraintsView(s),
+			&w = input.getSecondStageConstraintsView(s);
+		out.insert(out.end(),t.getElements(),t.getElements()+t.getNumElements());
+		out.insert(out.end(),w.getElements(),w.getElements()+w.getNumElements());
 	}
-	return sum;
+}
+}
 
+void triangleRows(int begin0, int end0, int nparts, int p, int &begin, int &end) {
+	double b2 = static_cast<double>(begin0)*begin0, e2 = static_cast<double>(end0)*end0;
+	begin = (p == 0) ? begin0 : static_cast<int>(sqrt(b2 + (e2-b2)*p/nparts));
+	end = (p == nparts-1) ? end0 : static_cast<int>(sqrt(b2 + (e2-b2)*(p+1)/nparts));
 }
-double calculateDistance(stochasticInput &input, int s1, int s2) {
 
+distributedDistances::distributedDistances(stochasticInput &input, MPI_Comm comm) : mpicomm(comm) {
 	assert(input.scenarioDimensionsEqual());
-	// skipping second-stage objective
-	vector<double> const &l1 = input.getSecondStageColLB(s1), 
-		&l2 = input.getSecondStageColLB(s2),
-		&u1 = input.getSecondStageColUB(s1), 
-		&u2 = input.getSecondStageColUB(s2), 
-		&bl1 = input.getSecondStageRowLB(s1), 
-		&bl2 = input.getSecondStageRowLB(s2),
-		&bu1 = input.getSecondStageRowUB(s1),
-		&bu2 = input.getSecondStageRowUB(s2);
+	nScen = input.nScenarios();
+	int mype, nprocs;
+	MPI_Comm_rank(comm,&mype);
+	MPI_Comm_size(comm,&nprocs);
 
-	double d = vectorDiff2(l1,l2) + vectorDiff2(u1,u2) + 
-		vectorDiff2(bl1,bl2) + vectorDiff2(bu1,bu2);
-	
-	if (!input.onlyBoundsVary()) {
-		const CoinPackedMatrix &t1 = input.getLinkingConstraints(s1),
-			&t2 = input.getLinkingConstraints(s2),
-			&w1 = input.getSecondStageConstraints(s1),
-			&w2 = input.getSecondStageConstraints(s2);
-			// assumes that nonzero pattern is identical
-			// SMPS "requires" this
-			assert(t1.getNumElements() == t2.getNumElements());
-			assert(w1.getNumElements() == w2.getNumElements());
-			d += vectorDiff2(t1.getElements(),t2.getElements(),t1.getNumElements());
-			d += vectorDiff2(w1.getElements(),w2.getElements(),w1.getNumElements());
+	// each process reads the scenarios of its rows
+	triangleRows(0,nScen,nprocs,mype,rowBegin,rowEnd);
+	vector<int> rowsBegin(nprocs+1);
+	for (int p = 0; p < nprocs; p++) {
+		int e;
+		triangleRows(0,nScen,nprocs,p,rowsBegin[p],e);
 	}
+	rowsBegin[nprocs] = nScen;
 
-	return sqrt(d);
-}
-}
-void generateDistances(double **&distances, stochasticInput& input) {
-	int nscen = input.nScenarios();
-	distances = new double*[nscen];
-	for (int i = 0; i < nscen; i++) distances[i] = new double[nscen];
+	// entries equal in all scenarios don't contribute
+	vector<double> ref, v;
+	scenarioData(input,0,ref);
+	int dim = ref.size();
+	vector<unsigned char> varies(dim,0);
+	for (int s = rowBegin; s < rowEnd; s++) {
+		scenarioData(input,s,v);
+		assert(static_cast<int>(v.size()) == dim);
+		for (int j = 0; j < dim; j++) if (v[j] != ref[j]) varies[j] = 1;
+	}
+	if (dim) MPI_Allreduce(MPI_IN_PLACE,&varies[0],dim,MPI_UNSIGNED_CHAR,MPI_MAX,comm);
+	vector<int> idx;
+	for (int j = 0; j < dim; j++) if (varies[j]) idx.push_back(j);
+	int nvary = idx.size();
+
+	vector<double> mine(static_cast<size_t>(rowEnd-rowBegin)*nvary+1);
+	for (int s = rowBegin; s < rowEnd; s++) {
+		scenarioData(input,s,v);
+		for (int k = 0; k < nvary; k++) mine[static_cast<size_t>(s-rowBegin)*nvary+k] = v[idx[k]];
+	}
+
+	d.resize(rowOffset(rowEnd)-rowOffset(rowBegin)+1);
 
-	for (int i = 0; i < nscen; i++)
-		for (int j = 0; j < nscen; j++) distances[i][j] = calculateDistance(input,i,j);
-	
+	// the owners broadcast their scenarios in blocks of columns, so a
+	// process holds the data of its rows and of one block instead of all
+	// nScen*nvary entries; a block is also small enough for an int count
+	int blockSize = (nScen+nprocs-1)/nprocs;
+	if (nvary > 0) blockSize = min(blockSize,INT_MAX/nvary);
+	if (blockSize < 1) blockSize = 1;
+	vector<double> block(static_cast<size_t>(blockSize)*nvary+1);
+	int owner = 0;
+	for (int cb = 0; cb < nScen; ) {
+		while (rowsBegin[owner+1] <= cb) owner++;
+		int ce = min(cb+blockSize,rowsBegin[owner+1]);
+		if (mype == owner) copy(mine.begin()+static_cast<size_t>(cb-rowBegin)*nvary,
+			mine.begin()+static_cast<size_t>(ce-rowBegin)*nvary, block.begin());
+		MPI_Bcast(&block[0],(ce-cb)*nvary,MPI_DOUBLE,owner,comm);
+
+		// distances from my rows i to the scenarios cb..ce-1 below i
+		#pragma omp parallel for schedule(dynamic,16)
+		for (int i = max(rowBegin,cb+1); i < rowEnd; i++) {
+			double *di = &d[0] + (rowOffset(i)-rowOffset(rowBegin));
+			double const *xi = &mine[static_cast<size_t>(i-rowBegin)*nvary];
+			int kEnd = min(ce,i);
+			for (int k = cb; k < kEnd; k++) di[k] = sqrt(vectorDiff2(xi,&block[static_cast<size_t>(k-cb)*nvary],nvary));
+		}
+		cb = ce;
+	}
 }
@@ -2,27 +2,33 @@
 #define SCENREDUTILS_HPP
 
 #include "stochasticInput.hpp"
+#include "mpi.h"
 
-struct distanceScenarioPair{ 
-	double d; int scen; 
-	bool operator<(const distanceScenarioPair &s) const { return (d < s.d); } 
-};
-// sort distances per scenario, saving the original indices
-// outer vector i contains sorted vector of distances between other scenarios and scenario i
-void sortDistances(double const*const* distances, int nScen, std::vector<std::vector<distanceScenarioPair> > &out);
+// split rows [begin0,end0) of a lower triangle into nparts contiguous
+// ranges with about the same number of entries; range p is [begin,end)
+void triangleRows(int begin0, int end0, int nparts, int p, int &begin, int &end);
+
+// lower triangle of the distance matrix, split by rows among the processes
+// of comm (see triangleRows); row i holds the distances from scenario i to
+// scenarios 0..i-1. Only the data that differ between scenarios are used.
+// Each process reads the scenarios of its rows from the input and receives
+// the others block by block, so it never holds all the scenario data.
+class distributedDistances {
+public:
+	distributedDistances(stochasticInput &, MPI_Comm comm);
 
-// calculates the objective to the optimal reduction problem
-double calculateObjective(const std::vector<std::vector<distanceScenarioPair> > &sortedDistances,  
-		double const *probabilities, bool const *keepingScenario);
+	int nScenarios() const { return nScen; }
+	int firstRow() const { return rowBegin; }
+	int lastRow() const { return rowEnd; } // one past
+	double const* row(int i) const { return &d[rowOffset(i)-rowOffset(rowBegin)]; }
+	MPI_Comm comm() const { return mpicomm; }
 
-// generate distance matrix
-// caller is responsible for freeing, using convenience function below
-void generateDistances(double **&distances, stochasticInput&);
-template <typename T> void freeDistances(T **d, stochasticInput&in) {
-	int nscen = in.nScenarios();
-	for (int i = 0; i < nscen; i++) delete [] d[i];
-	delete [] d;
-}
+private:
+	static size_t rowOffset(int i) { return static_cast<size_t>(i)*(i-1)/2; }
 
+	MPI_Comm mpicomm;
+	int nScen, rowBegin, rowEnd;
+	std::vector<double> d;
+};
 
 #endif
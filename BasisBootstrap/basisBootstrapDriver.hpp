@@ -243,6 +243,24 @@ public:
         virtual CoinPackedMatrix getSecondStageConstraints(int scen) { return inner.getSecondStageConstraints(realScenarios[scen]); }
         virtual CoinPackedMatrix getLinkingConstraints(int scen) { return inner.getLinkingConstraints(realScenarios[scen]); }
 
+        // views of the inner input; the rescaled objective uses the default
+        virtual const std::vector<double>& getFirstStageColLBView() { return inner.getFirstStageColLBView(); }
+        virtual const std::vector<double>& getFirstStageColUBView() { return inner.getFirstStageColUBView(); }
+        virtual const std::vector<double>& getFirstStageObjView() { return inner.getFirstStageObjView(); }
+        virtual const std::vector<std::string>& getFirstStageColNamesView() { return inner.getFirstStageColNamesView(); }
+        virtual const std::vector<double>& getFirstStageRowLBView() { return inner.getFirstStageRowLBView(); }
+        virtual const std::vector<double>& getFirstStageRowUBView() { return inner.getFirstStageRowUBView(); }
+        virtual const std::vector<std::string>& getFirstStageRowNamesView() { return inner.getFirstStageRowNamesView(); }
+        virtual const std::vector<double>& getSecondStageColLBView(int scen) { return inner.getSecondStageColLBView(realScenarios[scen]); }
+        virtual const std::vector<double>& getSecondStageColUBView(int scen) { return inner.getSecondStageColUBView(realScenarios[scen]); }
+        virtual const std::vector<std::string>& getSecondStageColNamesView(int scen) { return inner.getSecondStageColNamesView(realScenarios[scen]); }
+        virtual const std::vector<double>& getSecondStageRowUBView(int scen) { return inner.getSecondStageRowUBView(realScenarios[scen]); }
+        virtual const std::vector<double>& getSecondStageRowLBView(int scen) { return inner.getSecondStageRowLBView(realScenarios[scen]); }
+        virtual const std::vector<std::string>& getSecondStageRowNamesView(int scen) { return inner.getSecondStageRowNamesView(realScenarios[scen]); }
+        virtual const CoinPackedMatrix& getFirstStageConstraintsView() { return inner.getFirstStageConstraintsView(); }
+        virtual const CoinPackedMatrix& getSecondStageConstraintsView(int scen) { return inner.getSecondStageConstraintsView(realScenarios[scen]); }
+        virtual const CoinPackedMatrix& getLinkingConstraintsView(int scen) { return inner.getLinkingConstraintsView(realScenarios[scen]); }
+
         
 
         virtual bool scenarioDimensionsEqual() { return inner.scenarioDimensionsEqual(); }
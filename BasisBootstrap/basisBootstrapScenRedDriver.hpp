@@ -12,7 +12,7 @@ public:
 
 	void goFromScratch(int startingScenarios, int addedPer) {
 		// get starting scenarios from scenario reduction
-		std::vector<int> s = fastForwardSelection(this->input,startingScenarios);
+		std::vector<int> s = fastForwardSelection(this->input,startingScenarios,this->ctx.comm());
 
 		this->initializeMaster(s);
 		this->solveMaster();
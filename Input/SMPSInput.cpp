@@ -205,35 +205,32 @@ SMPSInput::SMPSInput(string const& cor, string const& tim, string const& sto) :
 
 }
 
-vector<double> SMPSInput::getSecondStageColLB(int scen) { 
+const vector<double>& SMPSInput::getSecondStageColLBView(int scen) {
 	cacheScenario(scen);
 	return scenarioData.at(scen).collb;
 
 }
 
-vector<double> SMPSInput::getSecondStageColUB(int scen) { 
+const vector<double>& SMPSInput::getSecondStageColUBView(int scen) {
 	cacheScenario(scen);
 	return scenarioData.at(scen).colub;
 
 }
 
-vector<double> SMPSInput::getSecondStageObj(int scen) { 
+const vector<double>& SMPSInput::getSecondStageObjView(int scen) {
 	cacheScenario(scen);
-	vector<double> obj = scenarioData.at(scen).obj;
-	double scale = scenarioProbability(scen);
-	for (unsigned i = 0; i < obj.size(); i++) obj[i] *= scale;
-	return obj;
+	return scenarioData.at(scen).objProb;
 
 }
 
-vector<double> SMPSInput::getSecondStageRowLB(int scen) { 
+const vector<double>& SMPSInput::getSecondStageRowLBView(int scen) {
 	cacheScenario(scen);
 	
 	return scenarioData.at(scen).rowlb;
 
 }
 
-vector<double> SMPSInput::getSecondStageRowUB(int scen) { 
+const vector<double>& SMPSInput::getSecondStageRowUBView(int scen) {
 	cacheScenario(scen);
 
 	return scenarioData.at(scen).rowub;
@@ -241,22 +238,24 @@ vector<double> SMPSInput::getSecondStageRowUB(int scen) {
 }
 
 
-vector<string> SMPSInput::getSecondStageColNames(int scen) {
+const vector<string>& SMPSInput::getSecondStageColNamesView(int scen) {
+	cacheScenario(scen);
 	return scenarioData.at(scen).colname;
 }
 
-vector<string> SMPSInput::getSecondStageRowNames(int scen) {
+const vector<string>& SMPSInput::getSecondStageRowNamesView(int scen) {
+	cacheScenario(scen);
 	return scenarioData.at(scen).rowname;
 }
 
 
-CoinPackedMatrix SMPSInput::getSecondStageConstraints(int scen) {
+const CoinPackedMatrix& SMPSInput::getSecondStageConstraintsView(int scen) {
 	cacheScenario(scen);
 	return (onlyboundsvary ? secondStageTemplate.mat : scenarioData[scen].mat);
 }
 
 
-CoinPackedMatrix SMPSInput::getLinkingConstraints(int scen) {
+const CoinPackedMatrix& SMPSInput::getLinkingConstraintsView(int scen) {
 	cacheScenario(scen);
 	return (onlyboundsvary ? TmatTemplate : Tmats[scen]);
 }
@@ -332,6 +331,12 @@ void SMPSInput::cacheScenario(int scen) {
 	// make sure we're at the end
 	getline(fs, line);
 	assert(line.find("SC") != string::npos || line.find("ENDATA") != string::npos);
+
+	// keep the objective already multiplied by the probability for the views
+	vector<double> &objProb = scenarioData[scen].objProb;
+	objProb = scenarioData[scen].obj;
+	double scale = scenarioProbability(scen);
+	for (unsigned i = 0; i < objProb.size(); i++) objProb[i] *= scale;
 	
 
 }
@@ -31,19 +31,19 @@ public:
 	  // relying on CoinMpsIO setting lower and upper bounds to zero and one, respectively.
 	  // Also note: CoinMpsIO uses a default tolerance of 1.0e-8 on integrality comparisons.
 	  const double intTol = 1.0e-8;
-	  bool isLBzero = (fabs(this->getFirstStageColLB().at(col)) < intTol);
-	  bool isUBone = (fabs(this->getFirstStageColUB().at(col) - 1.0) < intTol);
+	  bool isLBzero = (fabs(this->getFirstStageColLBView().at(col)) < intTol);
+	  bool isUBone = (fabs(this->getFirstStageColUBView().at(col) - 1.0) < intTol);
 	  return (isInteger && isLBzero && isUBone);
 	}
 
-	virtual std::vector<double> getSecondStageColLB(int scen);
-	virtual std::vector<double> getSecondStageColUB(int scen);
+	virtual std::vector<double> getSecondStageColLB(int scen) { return getSecondStageColLBView(scen); }
+	virtual std::vector<double> getSecondStageColUB(int scen) { return getSecondStageColUBView(scen); }
 	// objective vector, already multiplied by probability
-	virtual std::vector<double> getSecondStageObj(int scen);
-	virtual std::vector<std::string> getSecondStageColNames(int scen);
-	virtual std::vector<double> getSecondStageRowUB(int scen);
-	virtual std::vector<double> getSecondStageRowLB(int scen);
-	virtual std::vector<std::string> getSecondStageRowNames(int scen);
+	virtual std::vector<double> getSecondStageObj(int scen) { return getSecondStageObjView(scen); }
+	virtual std::vector<std::string> getSecondStageColNames(int scen) { return getSecondStageColNamesView(scen); }
+	virtual std::vector<double> getSecondStageRowUB(int scen) { return getSecondStageRowUBView(scen); }
+	virtual std::vector<double> getSecondStageRowLB(int scen) { return getSecondStageRowLBView(scen); }
+	virtual std::vector<std::string> getSecondStageRowNames(int scen) { return getSecondStageRowNamesView(scen); }
 	virtual double scenarioProbability(int scen) { return (probabilitiesequal) ? 1.0/nscen : probabilities.at(scen); }
 	virtual bool isSecondStageColInteger(int scen, int col) { return secondStageTemplate.isColInteger.at(col); }
         virtual bool isSecondStageColBinary(int scen, int col) {
@@ -53,17 +53,37 @@ public:
 	  // relying on CoinMpsIO setting lower and upper bounds to zero and one, respectively.
 	  // Also note: CoinMpsIO uses a default tolerance of 1.0e-8 on integrality comparisons.
 	  const double intTol = 1.0e-8;
-	  bool isLBzero = (fabs(this->getSecondStageColLB(scen).at(col)) < intTol);
-	  bool isUBone = (fabs(this->getSecondStageColUB(scen).at(col) - 1.0) < intTol);
+	  bool isLBzero = (fabs(this->getSecondStageColLBView(scen).at(col)) < intTol);
+	  bool isUBone = (fabs(this->getSecondStageColUBView(scen).at(col) - 1.0) < intTol);
 	  return (isInteger && isLBzero && isUBone);
 	}
 
 	// returns the column-oriented first-stage constraint matrix (A matrix)
 	virtual CoinPackedMatrix getFirstStageConstraints() { return firstStageData.mat; }
 	// returns the column-oriented second-stage constraint matrix (W matrix)
-	virtual CoinPackedMatrix getSecondStageConstraints(int scen);
+	virtual CoinPackedMatrix getSecondStageConstraints(int scen) { return getSecondStageConstraintsView(scen); }
 	// returns the column-oriented matrix linking the first-stage to the second (T matrix)
-	virtual CoinPackedMatrix getLinkingConstraints(int scen);
+	virtual CoinPackedMatrix getLinkingConstraints(int scen) { return getLinkingConstraintsView(scen); }
+
+	virtual const std::vector<double>& getFirstStageColLBView() { return firstStageData.collb; }
+	virtual const std::vector<double>& getFirstStageColUBView() { return firstStageData.colub; }
+	virtual const std::vector<double>& getFirstStageObjView() { return firstStageData.obj; }
+	virtual const std::vector<std::string>& getFirstStageColNamesView() { return firstStageData.colname; }
+	virtual const std::vector<double>& getFirstStageRowLBView() { return firstStageData.rowlb; }
+	virtual const std::vector<double>& getFirstStageRowUBView() { return firstStageData.rowub; }
+	virtual const std::vector<std::string>& getFirstStageRowNamesView() { return firstStageData.rowname; }
+
+	virtual const std::vector<double>& getSecondStageColLBView(int scen);
+	virtual const std::vector<double>& getSecondStageColUBView(int scen);
+	virtual const std::vector<double>& getSecondStageObjView(int scen);
+	virtual const std::vector<std::string>& getSecondStageColNamesView(int scen);
+	virtual const std::vector<double>& getSecondStageRowUBView(int scen);
+	virtual const std::vector<double>& getSecondStageRowLBView(int scen);
+	virtual const std::vector<std::string>& getSecondStageRowNamesView(int scen);
+
+	virtual const CoinPackedMatrix& getFirstStageConstraintsView() { return firstStageData.mat; }
+	virtual const CoinPackedMatrix& getSecondStageConstraintsView(int scen);
+	virtual const CoinPackedMatrix& getLinkingConstraintsView(int scen);
 
 
 
@@ -81,6 +101,7 @@ private:
 
 		int ncol, nrow;
 		std::vector<double> collb, colub, rowlb, rowub, obj;
+		std::vector<double> objProb; // obj scaled by the scenario probability
 		std::vector<bool> isColInteger;
 		CoinPackedMatrix mat;
 		std::vector<std::string> colname, rowname;
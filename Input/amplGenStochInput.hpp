@@ -63,25 +63,25 @@ public:
 		return nSecondStageCons_[scen];
 	}
 
-	virtual std::vector<double> getFirstStageColLB() {
+	virtual const std::vector<double>& getFirstStageColLBView() {
 		return firstStageData.collb;
 	}
-	virtual std::vector<double> getFirstStageColUB() {
+	virtual const std::vector<double>& getFirstStageColUBView() {
 		return firstStageData.colub;
 	}
-	virtual std::vector<double> getFirstStageObj() {
+	virtual const std::vector<double>& getFirstStageObjView() {
 		return firstStageData.objGrad;
 	}
-	virtual std::vector<std::string> getFirstStageColNames() {
+	virtual const std::vector<std::string>& getFirstStageColNamesView() {
 		return firstStageData.colnames;
 	}
-	virtual std::vector<double> getFirstStageRowLB() {
+	virtual const std::vector<double>& getFirstStageRowLBView() {
 		return firstStageData.rowlb;
 	}
-	virtual std::vector<double> getFirstStageRowUB() {
+	virtual const std::vector<double>& getFirstStageRowUBView() {
 		return firstStageData.rowub;
 	}
-	virtual std::vector<std::string> getFirstStageRowNames() {
+	virtual const std::vector<std::string>& getFirstStageRowNamesView() {
 		return firstStageData.rownames;
 	}
 
@@ -89,31 +89,31 @@ public:
 		return false;
 	}
 
-	virtual std::vector<double> getSecondStageColLB(int scen) {
+	virtual const std::vector<double>& getSecondStageColLBView(int scen) {
 		loadLocalNLdata(scen);
 		return localData[scen].collb;
 	}
-	virtual std::vector<double> getSecondStageColUB(int scen) {
+	virtual const std::vector<double>& getSecondStageColUBView(int scen) {
 		loadLocalNLdata(scen);
 		return localData[scen].colub;
 	}
-	virtual std::vector<double> getSecondStageObj(int scen) {
+	virtual const std::vector<double>& getSecondStageObjView(int scen) {
 		loadLocalNLdata(scen);
 		return localData[scen].objGrad;
 	}
-	virtual std::vector<std::string> getSecondStageColNames(int scen) {
+	virtual const std::vector<std::string>& getSecondStageColNamesView(int scen) {
 		loadLocalNLdata(scen);
 		return localData[scen].colnames;
 	}
-	virtual std::vector<double> getSecondStageRowLB(int scen) {
+	virtual const std::vector<double>& getSecondStageRowLBView(int scen) {
 		loadLocalNLdata(scen);
 		return localData[scen].rowlb;
 	}
-	virtual std::vector<double> getSecondStageRowUB(int scen) {
+	virtual const std::vector<double>& getSecondStageRowUBView(int scen) {
 		loadLocalNLdata(scen);
 		return localData[scen].rowub;
 	}
-	virtual std::vector<std::string> getSecondStageRowNames(int scen) {
+	virtual const std::vector<std::string>& getSecondStageRowNamesView(int scen) {
 		loadLocalNLdata(scen);
 		return localData[scen].rownames;
 	}
@@ -124,31 +124,31 @@ public:
 		return false;
 	}
 
-	virtual CoinPackedMatrix getFirstStageConstraints() {
+	virtual const CoinPackedMatrix& getFirstStageConstraintsView() {
 		MESSAGE("getFirstStageConstraints");
 		IF_VERBOSE_DO( Amat.dumpMatrix(); );
 		return Amat;
 	}
-	virtual CoinPackedMatrix getSecondStageConstraints(int scen) {
+	virtual const CoinPackedMatrix& getSecondStageConstraintsView(int scen) {
 		loadLocalNLdata(scen);
 		MESSAGE("getSecondStageConstraints scen" << scen);
 		IF_VERBOSE_DO( Wmat[scen].dumpMatrix(); );
 		return Wmat[scen];
 	}
-	virtual CoinPackedMatrix getLinkingConstraints(int scen) {
+	virtual const CoinPackedMatrix& getLinkingConstraintsView(int scen) {
 		loadLocalNLdata(scen);
 		MESSAGE("getLinkingConstraints scen" << scen);
 		IF_VERBOSE_DO( Tmat[scen].dumpMatrix(); );
 		return Tmat[scen];
 	}
 
-	virtual CoinPackedMatrix getFirstStageHessian() {
+	virtual const CoinPackedMatrix& getFirstStageHessianView() {
 		MESSAGE("getFirstStageHessian");
 		IF_VERBOSE_DO( QAmat.dumpMatrix(); );
 		return QAmat;
 	}
 	// Q_i
-	virtual CoinPackedMatrix getSecondStageHessian(int scen) {
+	virtual const CoinPackedMatrix& getSecondStageHessianView(int scen) {
 		loadLocalNLdata(scen);
 		MESSAGE("getSecondStageHessian scen" << scen);
 		IF_VERBOSE_DO( QWmat[scen].dumpMatrix(); );
@@ -156,13 +156,35 @@ public:
 	}
 	// column-oriented, \hat Q_i
 	// Note: this has the second-stage variables on the rows and first-stage on the columns
-	virtual CoinPackedMatrix getSecondStageCrossHessian(int scen) {
+	virtual const CoinPackedMatrix& getSecondStageCrossHessianView(int scen) {
 		loadLocalNLdata(scen);
 		MESSAGE("getSecondStageCrossHessian scen" << scen);
 		IF_VERBOSE_DO( QTmat[scen].dumpMatrix(); );
 		return QTmat[scen];
 	}
 
+	// by-value accessors are copies of the views
+	virtual std::vector<double> getFirstStageColLB() { return getFirstStageColLBView(); }
+	virtual std::vector<double> getFirstStageColUB() { return getFirstStageColUBView(); }
+	virtual std::vector<double> getFirstStageObj() { return getFirstStageObjView(); }
+	virtual std::vector<std::string> getFirstStageColNames() { return getFirstStageColNamesView(); }
+	virtual std::vector<double> getFirstStageRowLB() { return getFirstStageRowLBView(); }
+	virtual std::vector<double> getFirstStageRowUB() { return getFirstStageRowUBView(); }
+	virtual std::vector<std::string> getFirstStageRowNames() { return getFirstStageRowNamesView(); }
+	virtual std::vector<double> getSecondStageColLB(int scen) { return getSecondStageColLBView(scen); }
+	virtual std::vector<double> getSecondStageColUB(int scen) { return getSecondStageColUBView(scen); }
+	virtual std::vector<double> getSecondStageObj(int scen) { return getSecondStageObjView(scen); }
+	virtual std::vector<std::string> getSecondStageColNames(int scen) { return getSecondStageColNamesView(scen); }
+	virtual std::vector<double> getSecondStageRowLB(int scen) { return getSecondStageRowLBView(scen); }
+	virtual std::vector<double> getSecondStageRowUB(int scen) { return getSecondStageRowUBView(scen); }
+	virtual std::vector<std::string> getSecondStageRowNames(int scen) { return getSecondStageRowNamesView(scen); }
+	virtual CoinPackedMatrix getFirstStageConstraints() { return getFirstStageConstraintsView(); }
+	virtual CoinPackedMatrix getSecondStageConstraints(int scen) { return getSecondStageConstraintsView(scen); }
+	virtual CoinPackedMatrix getLinkingConstraints(int scen) { return getLinkingConstraintsView(scen); }
+	virtual CoinPackedMatrix getFirstStageHessian() { return getFirstStageHessianView(); }
+	virtual CoinPackedMatrix getSecondStageHessian(int scen) { return getSecondStageHessianView(scen); }
+	virtual CoinPackedMatrix getSecondStageCrossHessian(int scen) { return getSecondStageCrossHessianView(scen); }
+
 	virtual bool scenarioDimensionsEqual() {
 		return dimsEqual;
 	}
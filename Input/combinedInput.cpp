@@ -36,7 +36,7 @@ int combinedInput::nSecondStageCons(int scen) {
 
 namespace{
 template <typename T> vector<T> concatenateSubset(stochasticInput &data,  
-			vector<T>(stochasticInput::*second)(int),
+			const vector<T>& (stochasticInput::*second)(int),
 			int (stochasticInput::*secondDims)(int),
 			vector<int> const &scens) {
 	
@@ -59,37 +59,37 @@ template <typename T> vector<T> concatenateSubset(stochasticInput &data,
 
 
 vector<double> combinedInput::getSecondStageColLB(int scen) {
-	return concatenateSubset(inner,&stochasticInput::getSecondStageColLB,
+	return concatenateSubset(inner,&stochasticInput::getSecondStageColLBView,
 		&stochasticInput::nSecondStageVars,scenarioMap[scen]);
 }
 
 vector<double> combinedInput::getSecondStageColUB(int scen) {
-	return concatenateSubset(inner,&stochasticInput::getSecondStageColUB,
+	return concatenateSubset(inner,&stochasticInput::getSecondStageColUBView,
 		&stochasticInput::nSecondStageVars,scenarioMap[scen]);
 }
 
 vector<double> combinedInput::getSecondStageObj(int scen) {
-	return concatenateSubset(inner,&stochasticInput::getSecondStageObj,
+	return concatenateSubset(inner,&stochasticInput::getSecondStageObjView,
 		&stochasticInput::nSecondStageVars,scenarioMap[scen]);
 }
 
 vector<string> combinedInput::getSecondStageColNames(int scen) {
-	return concatenateSubset(inner,&stochasticInput::getSecondStageColNames,
+	return concatenateSubset(inner,&stochasticInput::getSecondStageColNamesView,
 		&stochasticInput::nSecondStageVars,scenarioMap[scen]);
 }
 
 vector<double> combinedInput::getSecondStageRowLB(int scen) {
-	return concatenateSubset(inner,&stochasticInput::getSecondStageRowLB,
+	return concatenateSubset(inner,&stochasticInput::getSecondStageRowLBView,
 		&stochasticInput::nSecondStageCons,scenarioMap[scen]);
 }
 
 vector<double> combinedInput::getSecondStageRowUB(int scen) {
-	return concatenateSubset(inner,&stochasticInput::getSecondStageRowUB,
+	return concatenateSubset(inner,&stochasticInput::getSecondStageRowUBView,
 		&stochasticInput::nSecondStageCons,scenarioMap[scen]);
 }
 
 vector<string> combinedInput::getSecondStageRowNames(int scen) {
-	return concatenateSubset(inner,&stochasticInput::getSecondStageRowNames,
+	return concatenateSubset(inner,&stochasticInput::getSecondStageRowNamesView,
 		&stochasticInput::nSecondStageCons,scenarioMap[scen]);
 }
 
@@ -118,7 +118,7 @@ CoinPackedMatrix combinedInput::getSecondStageConstraints(int scen) {
 	CoinBigIndex totalNnz = 0;
 	for (int k = 0; k < nScenarios; k++) {
 		int s = scenarioMap[scen][k];
-		totalNnz += inner.getSecondStageConstraints(s).getNumElements();
+		totalNnz += inner.getSecondStageConstraintsView(s).getNumElements();
 	}
 
 	// CoinPackedMatrix takes ownership of these, so we don't free them
@@ -133,7 +133,7 @@ CoinPackedMatrix combinedInput::getSecondStageConstraints(int scen) {
 	for (int k = 0; k < nScenarios; k++) {
 		int s = scenarioMap[scen][k];
 		int nSecondStageVars = inner.nSecondStageVars(s);
-		CoinPackedMatrix const &Wmat = inner.getSecondStageConstraints(s);
+		CoinPackedMatrix const &Wmat = inner.getSecondStageConstraintsView(s);
 		int const *Widx = Wmat.getIndices();
 		double const *Welts = Wmat.getElements();
 
@@ -163,10 +163,10 @@ CoinPackedMatrix combinedInput::getLinkingConstraints(int scen) {
 	int const nScenarios = scenarioMap[scen].size();
 	
 	
-	CoinPackedMatrix mat = inner.getLinkingConstraints(scenarioMap[scen][0]);
+	CoinPackedMatrix mat = inner.getLinkingConstraintsView(scenarioMap[scen][0]);
 
 	for (int k = 1; k < nScenarios; k++) {
-		mat.bottomAppendPackedMatrix(inner.getLinkingConstraints(scenarioMap[scen][k]));
+		mat.bottomAppendPackedMatrix(inner.getLinkingConstraintsView(scenarioMap[scen][k]));
 	}
 
 	return mat;
@@ -14,13 +14,13 @@ public:
 	virtual int nSecondStageVars(int scen);
 	virtual int nSecondStageCons(int scen);
 
-	virtual std::vector<double> getFirstStageColLB() { return inner.getFirstStageColLB(); }
-	virtual std::vector<double> getFirstStageColUB() { return inner.getFirstStageColUB(); }
-	virtual std::vector<double> getFirstStageObj() { return inner.getFirstStageObj(); }
-	virtual std::vector<std::string> getFirstStageColNames() { return inner.getFirstStageColNames(); }
-	virtual std::vector<double> getFirstStageRowLB() { return inner.getFirstStageRowLB(); }
-	virtual std::vector<double> getFirstStageRowUB() { return inner.getFirstStageRowUB(); }
-	virtual std::vector<std::string> getFirstStageRowNames() { return inner.getFirstStageRowNames(); }
+	virtual std::vector<double> getFirstStageColLB() { return inner.getFirstStageColLBView(); }
+	virtual std::vector<double> getFirstStageColUB() { return inner.getFirstStageColUBView(); }
+	virtual std::vector<double> getFirstStageObj() { return inner.getFirstStageObjView(); }
+	virtual std::vector<std::string> getFirstStageColNames() { return inner.getFirstStageColNamesView(); }
+	virtual std::vector<double> getFirstStageRowLB() { return inner.getFirstStageRowLBView(); }
+	virtual std::vector<double> getFirstStageRowUB() { return inner.getFirstStageRowUBView(); }
+	virtual std::vector<std::string> getFirstStageRowNames() { return inner.getFirstStageRowNamesView(); }
 	virtual bool isFirstStageColInteger(int col) { return inner.isFirstStageColInteger(col); }
 
 	virtual std::vector<double> getSecondStageColLB(int scen);
@@ -33,10 +33,21 @@ public:
 	virtual double scenarioProbability(int scen);
 	virtual bool isSecondStageColInteger(int scen, int col);
 
-	virtual CoinPackedMatrix getFirstStageConstraints() { return inner.getFirstStageConstraints(); }
+	virtual CoinPackedMatrix getFirstStageConstraints() { return inner.getFirstStageConstraintsView(); }
 	virtual CoinPackedMatrix getSecondStageConstraints(int scen);
 	virtual CoinPackedMatrix getLinkingConstraints(int scen);
 
+	// second-stage views of a combined scenario use the default, which keeps
+	// the concatenation built by the by-value accessors
+	virtual const std::vector<double>& getFirstStageColLBView() { return inner.getFirstStageColLBView(); }
+	virtual const std::vector<double>& getFirstStageColUBView() { return inner.getFirstStageColUBView(); }
+	virtual const std::vector<double>& getFirstStageObjView() { return inner.getFirstStageObjView(); }
+	virtual const std::vector<std::string>& getFirstStageColNamesView() { return inner.getFirstStageColNamesView(); }
+	virtual const std::vector<double>& getFirstStageRowLBView() { return inner.getFirstStageRowLBView(); }
+	virtual const std::vector<double>& getFirstStageRowUBView() { return inner.getFirstStageRowUBView(); }
+	virtual const std::vector<std::string>& getFirstStageRowNamesView() { return inner.getFirstStageRowNamesView(); }
+	virtual const CoinPackedMatrix& getFirstStageConstraintsView() { return inner.getFirstStageConstraintsView(); }
+
 	
 
 	
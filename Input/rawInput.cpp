@@ -3,10 +3,17 @@
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <cstring>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 using namespace std;
 
-rawInput::rawInput(const string &datarootname, int overrideScenarioNumber, MPI_Comm comm) : datarootname(datarootname) {
+rawInput::rawInput(const string &datarootname, int overrideScenarioNumber, MPI_Comm comm, bool useBinaryCache) :
+  datarootname(datarootname), binData(0), binLen(0), binScenarios(0) {
 
   unsigned filelen;
   char *filedata;
@@ -35,17 +42,39 @@ rawInput::rawInput(const string &datarootname, int overrideScenarioNumber, MPI_C
   
   parseZeroData(data, overrideScenarioNumber);
 
+  if (useBinaryCache) {
+    string binname = datarootname + "bin";
+    int haveBinary = 0;
+    if (mype_ == 0) {
+      struct stat bst, zst;
+      haveBinary = stat(binname.c_str(), &bst) == 0;
+      // a cache older than the first-stage file was written for other data
+      if (haveBinary && stat((datarootname + "0").c_str(), &zst) == 0 &&
+	  bst.st_mtime < zst.st_mtime) {
+	cerr << binname << " is older than " << datarootname
+	     << "0, reading the text files instead" << endl;
+	haveBinary = 0;
+      }
+    }
+    MPI_Bcast(&haveBinary,1,MPI_INT,0,comm);
+    if (haveBinary) openBinaryCache(binname);
+  }
+
 }
 
 rawInput::rawInput(const std::string &datarootname, 
 		   const std::string& zerodata, 
 		   int overrideScenarioNumber /*= 0*/, 
 		   MPI_Comm comm /*= MPI_COMM_SELF*/)
-  : datarootname(datarootname)
+  : datarootname(datarootname), binData(0), binLen(0), binScenarios(0)
 {
   parseZeroData(zerodata, overrideScenarioNumber);
 }
 
+rawInput::~rawInput() {
+  if (binData) munmap(binData, binLen);
+}
+
 void rawInput::parseZeroData(const std::string &zerodata, int overrideScenarioNumber)
 {
 	istringstream f1(zerodata);
@@ -174,6 +203,20 @@ void rawInput::loadLocalScenData(int scen) {
 	//cout << "Proc " << mype_ << " rawInput::loadLocalScenData for scenario " << scen << endl;
 	localData[scen].initialize(nSecondStageVars_,nSecondStageCons_);
 
+	if (binData) readScenBinary(scen, localData[scen]);
+	else readScenText(scen, localData[scen]);
+
+	if (nScenariosTrue != nScenarios_) {
+		double scale = static_cast<double>(nScenariosTrue)/static_cast<double>(nScenarios_);
+		//printf("Rescaling scenario objectives by %f\n",scale);
+		// NOTE WE'RE ASSUMING EQUALLY-LIKELY SCENARIOS
+		// DON'T OVERRIDE SCENARIO COUNT IF THAT'S NOT THE CASE
+		for (int i = 0; i < nSecondStageVars_; i++) localData[scen].obj[i] *= scale;
+	}
+
+}
+
+void rawInput::readScenText(int scen, scenData &d) {
 	stringstream fname;
 	fname << datarootname << scen+1;
 	ifstream f(fname.str().c_str());
@@ -192,61 +235,178 @@ void rawInput::loadLocalScenData(int scen) {
 	getline(f,line);
 	size_t loc = line.find("Only Bounds Vary");
 	assert(loc == 0);
-	double scale = 1.0;
-	if (nScenariosTrue != nScenarios_) {
-		scale = static_cast<double>(nScenariosTrue)/static_cast<double>(nScenarios_);
-		//printf("Rescaling scenario objectives by %f\n",scale);
-	}
 
 	for (int i = 0; i < nvar; i++) {
-		f >> localData[scen].colnames[i];
-		f >> localData[scen].collb[i];
-		f >> localData[scen].colub[i];
-		f >> localData[scen].obj[i];
-		
-		// NOTE WE'RE ASSUMING EQUALLY-LIKELY SCENARIOS
-		// DON'T OVERRIDE SCENARIO COUNT IF THAT'S NOT THE CASE
-		localData[scen].obj[i] *= scale;
+		f >> d.colnames[i];
+		f >> d.collb[i];
+		f >> d.colub[i];
+		f >> d.obj[i];
 	}
 	for (int i = 0; i < ncons; i++) {
-		f >> localData[scen].rownames[i];
-		f >> localData[scen].rowlb[i];
-		f >> localData[scen].rowub[i];
+		f >> d.rownames[i];
+		f >> d.rowlb[i];
+		f >> d.rowub[i];
+	}
+
+}
+
+/* Binary cache layout, native byte order:
+   char    magic[8]                 "PIPSRAW1"
+   int     nScenarios, nvar, ncons  second-stage dimensions
+   int64_t offset[nScenarios+1]     byte offset of each scenario record,
+                                    the last one is the file length
+   then for each scenario
+   double  collb[nvar], colub[nvar], obj[nvar], rowlb[ncons], rowub[ncons]
+   names   nvar column names then ncons row names, each as an int length
+           followed by the characters
+   The objective is stored as in the text files, before any rescaling.
+   Matrices are not stored: only bounds vary, so W and T come from the
+   first-stage file as before.
+*/
+static const char binMagic[8] = { 'P','I','P','S','R','A','W','1' };
+static const size_t binHeaderLen = sizeof(binMagic) + 3*sizeof(int);
+
+void rawInput::openBinaryCache(const string &fname) {
+	int fd = open(fname.c_str(), O_RDONLY);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) != 0) {
+		cerr << "Unable to open" << fname << " from process " << mype_ << endl;
+		MPI_Abort(MPI_COMM_WORLD,1);
+	}
+	binLen = st.st_size;
+	void *p = mmap(0, binLen, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED) {
+		cerr << "Unable to map" << fname << " from process " << mype_ << endl;
+		MPI_Abort(MPI_COMM_WORLD,1);
+	}
+	binData = static_cast<char*>(p);
+
+	// a cache of another problem, or written for fewer scenarios, is not
+	// used; all the processes see the same file and come to the same result
+	int dims[3] = { 0, 0, 0 };
+	bool valid = binLen >= binHeaderLen && memcmp(binData, binMagic, sizeof(binMagic)) == 0;
+	if (valid) {
+		memcpy(dims, binData + sizeof(binMagic), sizeof(dims));
+		valid = dims[1] == nSecondStageVars_ && dims[2] == nSecondStageCons_ &&
+			dims[0] >= nScenarios_ &&
+			binLen >= binHeaderLen + ((size_t)dims[0]+1)*sizeof(int64_t);
+	}
+	if (!valid) {
+		if (mype_ == 0) cerr << fname << " does not match " << datarootname
+			<< "0 or has too few scenarios, reading the text files instead" << endl;
+		munmap(binData, binLen);
+		binData = 0;
+		binLen = 0;
+		return;
+	}
+	binScenarios = dims[0];
+}
+
+void rawInput::readScenBinary(int scen, scenData &d) {
+	assert(scen < binScenarios);
+	int64_t range[2];
+	memcpy(range, binData + binHeaderLen + scen*sizeof(int64_t), sizeof(range));
+	int nvar = nSecondStageVars_, ncons = nSecondStageCons_;
+	size_t nbytes = (3*(size_t)nvar + 2*(size_t)ncons)*sizeof(double);
+	bool valid = range[0] >= (int64_t)binHeaderLen && range[1] <= (int64_t)binLen &&
+		range[1]-range[0] >= (int64_t)nbytes;
+
+	const char *p = binData + range[0], *end = binData + range[1];
+	if (valid) {
+		memcpy(&d.collb[0], p, nvar*sizeof(double)); p += nvar*sizeof(double);
+		memcpy(&d.colub[0], p, nvar*sizeof(double)); p += nvar*sizeof(double);
+		memcpy(&d.obj[0], p, nvar*sizeof(double)); p += nvar*sizeof(double);
+		memcpy(&d.rowlb[0], p, ncons*sizeof(double)); p += ncons*sizeof(double);
+		memcpy(&d.rowub[0], p, ncons*sizeof(double)); p += ncons*sizeof(double);
+	}
+	int len;
+	for (int i = 0; valid && i < nvar+ncons; i++) {
+		valid = end-p >= (ptrdiff_t)sizeof(int);
+		if (!valid) break;
+		memcpy(&len, p, sizeof(int)); p += sizeof(int);
+		valid = len >= 0 && end-p >= len;
+		if (!valid) break;
+		string &name = (i < nvar) ? d.colnames[i] : d.rownames[i-nvar];
+		name.assign(p, len); p += len;
+	}
+	if (!valid || p != end) {
+		cerr << "Corrupt record of scenario " << scen << " in the binary cache of "
+			<< datarootname << " on process " << mype_ << endl;
+		MPI_Abort(MPI_COMM_WORLD,1);
+	}
+}
+
+void rawInput::writeBinaryCache(const string &fname) {
+	ofstream f(fname.c_str(), ios::out | ios::binary);
+	if (!f.is_open()) {
+		cerr << "Unable to open" << fname << " from process " << mype_ << endl;
+		MPI_Abort(MPI_COMM_WORLD,1);
+	}
+	f.exceptions(ofstream::failbit | ofstream::badbit);
+
+	int nscen = nScenarios_, nvar = nSecondStageVars_, ncons = nSecondStageCons_;
+	int dims[3] = { nscen, nvar, ncons };
+	f.write(binMagic, sizeof(binMagic));
+	f.write((const char*)dims, sizeof(dims));
+	// offsets are filled in once all the records are written
+	vector<int64_t> offset(nscen+1, 0);
+	f.write((const char*)&offset[0], offset.size()*sizeof(int64_t));
+
+	scenData d;
+	d.initialize(nvar, ncons);
+	for (int scen = 0; scen < nscen; scen++) {
+		offset[scen] = f.tellp();
+		readScenText(scen, d);
+		f.write((const char*)&d.collb[0], nvar*sizeof(double));
+		f.write((const char*)&d.colub[0], nvar*sizeof(double));
+		f.write((const char*)&d.obj[0], nvar*sizeof(double));
+		f.write((const char*)&d.rowlb[0], ncons*sizeof(double));
+		f.write((const char*)&d.rowub[0], ncons*sizeof(double));
+		for (int i = 0; i < nvar+ncons; i++) {
+			const string &name = (i < nvar) ? d.colnames[i] : d.rownames[i-nvar];
+			int len = name.length();
+			f.write((const char*)&len, sizeof(int));
+			f.write(name.data(), len);
+		}
 	}
+	offset[nscen] = f.tellp();
 
+	f.seekp(binHeaderLen);
+	f.write((const char*)&offset[0], offset.size()*sizeof(int64_t));
 }
 
-vector<double> rawInput::getSecondStageColLB(int scen) {
+const vector<double>& rawInput::getSecondStageColLBView(int scen) {
 	loadLocalScenData(scen);
 	return localData[scen].collb;
 }
 
-vector<double> rawInput::getSecondStageColUB(int scen) {
+const vector<double>& rawInput::getSecondStageColUBView(int scen) {
 	loadLocalScenData(scen);
 	return localData[scen].colub;
 }
 
-vector<double> rawInput::getSecondStageObj(int scen) {
+const vector<double>& rawInput::getSecondStageObjView(int scen) {
 	loadLocalScenData(scen);
 	return localData[scen].obj;
 }
 
-vector<string> rawInput::getSecondStageColNames(int scen) {
+const vector<string>& rawInput::getSecondStageColNamesView(int scen) {
 	loadLocalScenData(scen);
 	return localData[scen].colnames;
 }
 
-vector<double> rawInput::getSecondStageRowUB(int scen) {
+const vector<double>& rawInput::getSecondStageRowUBView(int scen) {
 	loadLocalScenData(scen);
 	return localData[scen].rowub;
 }
 
-vector<double> rawInput::getSecondStageRowLB(int scen) {
+const vector<double>& rawInput::getSecondStageRowLBView(int scen) {
 	loadLocalScenData(scen);
 	return localData[scen].rowlb;
 }
 
-vector<string> rawInput::getSecondStageRowNames(int scen) {
+const vector<string>& rawInput::getSecondStageRowNamesView(int scen) {
 	loadLocalScenData(scen);
 	return localData[scen].rownames;
 }
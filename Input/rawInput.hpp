@@ -5,11 +5,23 @@
 #include "mpi.h"
 
 // reads format written by dumpSmlModel.cpp
+//
+// The second-stage data can also come from a binary cache written by
+// writeBinaryCache (see the rawToBinary driver), named <datarootname>bin.
+// When that file exists it is memory-mapped and a scenario is copied out of
+// the mapping the first time it is asked for, so each process only touches
+// the pages of its own scenarios. Pass useBinaryCache=false to always parse
+// the text files.
 class rawInput : public stochasticInput {
 public:
 
-  rawInput(const std::string &datarootname, int overrideScenarioNumber = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  rawInput(const std::string &datarootname, int overrideScenarioNumber = 0, MPI_Comm comm = MPI_COMM_WORLD, bool useBinaryCache = true);
   rawInput(const std::string &datarootname, const std::string& zerodata, int overrideScenarioNumber = 0, MPI_Comm comm = MPI_COMM_SELF);
+  virtual ~rawInput();
+
+	// parses the text files of scenarios 0..nScenarios()-1 and writes them
+	// to the binary cache fname
+	void writeBinaryCache(const std::string &fname);
 
 	virtual int nScenarios() { return nScenarios_; }
 	virtual int nFirstStageVars() { return nFirstStageVars_; }
@@ -26,13 +38,13 @@ public:
 	virtual std::vector<std::string> getFirstStageRowNames() { return firstStageData.rownames; }
 	virtual bool isFirstStageColInteger(int col) { return false; }
 
-	virtual std::vector<double> getSecondStageColLB(int scen);
-	virtual std::vector<double> getSecondStageColUB(int scen);
-	virtual std::vector<double> getSecondStageObj(int scen);
-	virtual std::vector<std::string> getSecondStageColNames(int scen);
-	virtual std::vector<double> getSecondStageRowUB(int scen);
-	virtual std::vector<double> getSecondStageRowLB(int scen);
-	virtual std::vector<std::string> getSecondStageRowNames(int scen);
+	virtual std::vector<double> getSecondStageColLB(int scen) { return getSecondStageColLBView(scen); }
+	virtual std::vector<double> getSecondStageColUB(int scen) { return getSecondStageColUBView(scen); }
+	virtual std::vector<double> getSecondStageObj(int scen) { return getSecondStageObjView(scen); }
+	virtual std::vector<std::string> getSecondStageColNames(int scen) { return getSecondStageColNamesView(scen); }
+	virtual std::vector<double> getSecondStageRowUB(int scen) { return getSecondStageRowUBView(scen); }
+	virtual std::vector<double> getSecondStageRowLB(int scen) { return getSecondStageRowLBView(scen); }
+	virtual std::vector<std::string> getSecondStageRowNames(int scen) { return getSecondStageRowNamesView(scen); }
 	virtual double scenarioProbability(int scen) { return 1.0/nScenarios_; }
 	virtual bool isSecondStageColInteger(int scen, int col) { return false; }
 
@@ -40,7 +52,26 @@ public:
 	virtual CoinPackedMatrix getSecondStageConstraints(int scen) { return Wmat; }
 	virtual CoinPackedMatrix getLinkingConstraints(int scen) { return Tmat; }
 
-	
+	virtual const std::vector<double>& getFirstStageColLBView() { return firstStageData.collb; }
+	virtual const std::vector<double>& getFirstStageColUBView() { return firstStageData.colub; }
+	virtual const std::vector<double>& getFirstStageObjView() { return firstStageData.obj; }
+	virtual const std::vector<std::string>& getFirstStageColNamesView() { return firstStageData.colnames; }
+	virtual const std::vector<double>& getFirstStageRowLBView() { return firstStageData.rowlb; }
+	virtual const std::vector<double>& getFirstStageRowUBView() { return firstStageData.rowub; }
+	virtual const std::vector<std::string>& getFirstStageRowNamesView() { return firstStageData.rownames; }
+
+	virtual const std::vector<double>& getSecondStageColLBView(int scen);
+	virtual const std::vector<double>& getSecondStageColUBView(int scen);
+	virtual const std::vector<double>& getSecondStageObjView(int scen);
+	virtual const std::vector<std::string>& getSecondStageColNamesView(int scen);
+	virtual const std::vector<double>& getSecondStageRowUBView(int scen);
+	virtual const std::vector<double>& getSecondStageRowLBView(int scen);
+	virtual const std::vector<std::string>& getSecondStageRowNamesView(int scen);
+
+	// every scenario shares the same W and T
+	virtual const CoinPackedMatrix& getFirstStageConstraintsView() { return Amat; }
+	virtual const CoinPackedMatrix& getSecondStageConstraintsView(int scen) { return Wmat; }
+	virtual const CoinPackedMatrix& getLinkingConstraintsView(int scen) { return Tmat; }
 
 	virtual bool scenarioDimensionsEqual() { return true; }
 	virtual bool onlyBoundsVary() { return true; }
@@ -57,6 +88,9 @@ protected:
 		void initialize(int nvar, int ncons);
 	};
 	void loadLocalScenData(int scen);
+	void readScenText(int scen, scenData &d);
+	void readScenBinary(int scen, scenData &d);
+	void openBinaryCache(const std::string &fname);
 	CoinPackedMatrix Amat, Tmat, Wmat;
 	std::vector<scenData> localData;
 	const std::string datarootname;
@@ -65,6 +99,11 @@ protected:
 	int mype_;
 
 	int nScenarios_, nFirstStageVars_, nFirstStageCons_, nSecondStageVars_, nSecondStageCons_;
+
+	// memory-mapped binary cache, 0 if the text files are read
+	char *binData;
+	size_t binLen;
+	int binScenarios;
 private:
   void parseZeroData(const std::string &zerodata, int overrideScenarioNumber);
 };
@@ -20,3 +20,86 @@ CoinPackedMatrix stochasticInput::getSecondStageCrossHessian(int scen) {
 	std::vector<CoinBigIndex> starts(nvar1+1,0.);
 	return CoinPackedMatrix(true,nvar2,nvar1,0,0,0,&starts[0],0);
 }
+
+// Default view accessors: the by-value accessor is called and the result is
+// kept in the slot of the view until the view is asked for another scenario.
+enum { FirstColLB, FirstColUB, FirstObj, FirstColNames, FirstRowLB, FirstRowUB,
+	FirstRowNames, SecondColLB, SecondColUB, SecondObj, SecondColNames,
+	SecondRowUB, SecondRowLB, SecondRowNames, FirstCons, SecondCons, LinkingCons,
+	FirstHessian, SecondHessian, SecondCrossHessian };
+
+#define DEFAULT_VIEW(type,cache,kind,forScen,getter) \
+	viewSlot<type> &slot = cache[kind]; \
+	if (slot.scen != forScen) { \
+		slot.data = getter; \
+		slot.scen = forScen; \
+	} \
+	return slot.data;
+
+const std::vector<double>& stochasticInput::getFirstStageColLBView() {
+	DEFAULT_VIEW(std::vector<double>,doubleViews,FirstColLB,-1,getFirstStageColLB())
+}
+const std::vector<double>& stochasticInput::getFirstStageColUBView() {
+	DEFAULT_VIEW(std::vector<double>,doubleViews,FirstColUB,-1,getFirstStageColUB())
+}
+const std::vector<double>& stochasticInput::getFirstStageObjView() {
+	DEFAULT_VIEW(std::vector<double>,doubleViews,FirstObj,-1,getFirstStageObj())
+}
+const std::vector<std::string>& stochasticInput::getFirstStageColNamesView() {
+	DEFAULT_VIEW(std::vector<std::string>,stringViews,FirstColNames,-1,getFirstStageColNames())
+}
+const std::vector<double>& stochasticInput::getFirstStageRowLBView() {
+	DEFAULT_VIEW(std::vector<double>,doubleViews,FirstRowLB,-1,getFirstStageRowLB())
+}
+const std::vector<double>& stochasticInput::getFirstStageRowUBView() {
+	DEFAULT_VIEW(std::vector<double>,doubleViews,FirstRowUB,-1,getFirstStageRowUB())
+}
+const std::vector<std::string>& stochasticInput::getFirstStageRowNamesView() {
+	DEFAULT_VIEW(std::vector<std::string>,stringViews,FirstRowNames,-1,getFirstStageRowNames())
+}
+
+const std::vector<double>& stochasticInput::getSecondStageColLBView(int scen) {
+	DEFAULT_VIEW(std::vector<double>,doubleViews,SecondColLB,scen,getSecondStageColLB(scen))
+}
+const std::vector<double>& stochasticInput::getSecondStageColUBView(int scen) {
+	DEFAULT_VIEW(std::vector<double>,doubleViews,SecondColUB,scen,getSecondStageColUB(scen))
+}
+const std::vector<double>& stochasticInput::getSecondStageObjView(int scen) {
+	DEFAULT_VIEW(std::vector<double>,doubleViews,SecondObj,scen,getSecondStageObj(scen))
+}
+const std::vector<std::string>& stochasticInput::getSecondStageColNamesView(int scen) {
+	DEFAULT_VIEW(std::vector<std::string>,stringViews,SecondColNames,scen,getSecondStageColNames(scen))
+}
+const std::vector<double>& stochasticInput::getSecondStageRowUBView(int scen) {
+	DEFAULT_VIEW(std::vector<double>,doubleViews,SecondRowUB,scen,getSecondStageRowUB(scen))
+}
+const std::vector<double>& stochasticInput::getSecondStageRowLBView(int scen) {
+	DEFAULT_VIEW(std::vector<double>,doubleViews,SecondRowLB,scen,getSecondStageRowLB(scen))
+}
+const std::vector<std::string>& stochasticInput::getSecondStageRowNamesView(int scen) {
+	DEFAULT_VIEW(std::vector<std::string>,stringViews,SecondRowNames,scen,getSecondStageRowNames(scen))
+}
+
+const CoinPackedMatrix& stochasticInput::getFirstStageConstraintsView() {
+	DEFAULT_VIEW(CoinPackedMatrix,matrixViews,FirstCons,-1,getFirstStageConstraints())
+}
+
+const CoinPackedMatrix& stochasticInput::getSecondStageConstraintsView(int scen) {
+	DEFAULT_VIEW(CoinPackedMatrix,matrixViews,SecondCons,scen,getSecondStageConstraints(scen))
+}
+const CoinPackedMatrix& stochasticInput::getLinkingConstraintsView(int scen) {
+	DEFAULT_VIEW(CoinPackedMatrix,matrixViews,LinkingCons,scen,getLinkingConstraints(scen))
+}
+
+const CoinPackedMatrix& stochasticInput::getFirstStageHessianView() {
+	DEFAULT_VIEW(CoinPackedMatrix,matrixViews,FirstHessian,-1,getFirstStageHessian())
+}
+
+const CoinPackedMatrix& stochasticInput::getSecondStageHessianView(int scen) {
+	DEFAULT_VIEW(CoinPackedMatrix,matrixViews,SecondHessian,scen,getSecondStageHessian(scen))
+}
+const CoinPackedMatrix& stochasticInput::getSecondStageCrossHessianView(int scen) {
+	DEFAULT_VIEW(CoinPackedMatrix,matrixViews,SecondCrossHessian,scen,getSecondStageCrossHessian(scen))
+}
+
+#undef DEFAULT_VIEW
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <map>
 #include "CoinPackedMatrix.hpp"
 
 // Stochastic (MI)LP readers will implement this virtual class
@@ -102,6 +103,43 @@ public:
 	virtual CoinPackedMatrix getSecondStageCrossHessian(int scen);
 
 
+	/* View accessors:
+	Same data as the by-value accessors above, returned as a const reference
+	(use .size() and &v[0] for a pointer+length view) so that callers that
+	touch every scenario do not copy vectors and CoinPackedMatrix objects.
+	The reference is only guaranteed to stay valid until the next call of
+	the same accessor.
+
+	Readers that keep the data in memory (rawInput, SMPSInput, combinedInput,
+	amplGenStochInput) override these and implement the by-value accessors
+	as copies of the views. The default implementations call the by-value
+	accessor and keep only its last result, one per accessor, so they hold
+	at most one extra copy of each kind of data.
+	*/
+	virtual const std::vector<double>& getFirstStageColLBView();
+	virtual const std::vector<double>& getFirstStageColUBView();
+	virtual const std::vector<double>& getFirstStageObjView();
+	virtual const std::vector<std::string>& getFirstStageColNamesView();
+	virtual const std::vector<double>& getFirstStageRowLBView();
+	virtual const std::vector<double>& getFirstStageRowUBView();
+	virtual const std::vector<std::string>& getFirstStageRowNamesView();
+
+	virtual const std::vector<double>& getSecondStageColLBView(int scen);
+	virtual const std::vector<double>& getSecondStageColUBView(int scen);
+	virtual const std::vector<double>& getSecondStageObjView(int scen);
+	virtual const std::vector<std::string>& getSecondStageColNamesView(int scen);
+	virtual const std::vector<double>& getSecondStageRowUBView(int scen);
+	virtual const std::vector<double>& getSecondStageRowLBView(int scen);
+	virtual const std::vector<std::string>& getSecondStageRowNamesView(int scen);
+
+	virtual const CoinPackedMatrix& getFirstStageConstraintsView();
+	virtual const CoinPackedMatrix& getSecondStageConstraintsView(int scen);
+	virtual const CoinPackedMatrix& getLinkingConstraintsView(int scen);
+
+	virtual const CoinPackedMatrix& getFirstStageHessianView();
+	virtual const CoinPackedMatrix& getSecondStageHessianView(int scen);
+	virtual const CoinPackedMatrix& getSecondStageCrossHessianView(int scen);
+
         virtual int nLinkCons(){ return 0; }
         virtual int nLinkECons(){ return 0; }
         virtual int nLinkICons(){ return 0; }
@@ -109,6 +147,18 @@ public:
 	std::string datarootname;
     int useInputDate;
 
+private:
+	// last result of a default view accessor and the scenario it is for
+	// (-1 for the first stage)
+	template<typename T> struct viewSlot {
+		viewSlot() : scen(-2) {}
+		int scen;
+		T data;
+	};
+	// one slot per default view accessor
+	std::map<int, viewSlot<std::vector<double> > > doubleViews;
+	std::map<int, viewSlot<std::vector<std::string> > > stringViews;
+	std::map<int, viewSlot<CoinPackedMatrix> > matrixViews;
 };
 
 
@@ -8,6 +8,8 @@
 #include <boost/shared_ptr.hpp>
 #include <sstream>
 #include <fstream>
+#include <algorithm>
+#include <cmath>
 
 using boost::shared_ptr;
 
@@ -53,6 +55,8 @@ public:
 		bestPrimalObj = COIN_DBL_MAX;
 		relativeConvergenceTol = 1e-7;
 		terminated_ = false;
+		asyncComm = MPI_COMM_NULL;
+		partialEvaluation = false;
 	}
 
 
@@ -60,6 +64,16 @@ public:
 	bool terminated() { return terminated_; }
 	void iterate();
 
+	// Asynchronous mode: rank 0 of comm runs the bundle method and the other
+	// ranks only solve Lagrangian subproblems, pulling scenarios from a queue
+	// on rank 0 (longest previous solve first). The manager must be built with
+	// a BAContext over MPI_COMM_SELF on every rank of comm.
+	// An evaluation returns once the given fraction of the scenarios have been
+	// evaluated at the point; the others keep running and their cuts are added
+	// to the bundle when they arrive. Until then the objective uses their last
+	// known values, and convergence is confirmed with a complete evaluation.
+	void setAsynchronous(MPI_Comm comm, double fraction);
+
 protected:
 
 	virtual void doStep() = 0;
@@ -70,6 +84,17 @@ protected:
 
 	void evaluateAndUpdate();
 	void checkLastPrimals();
+
+	// asynchronous mode, see setAsynchronous
+	enum { asyncWorkTag = 301, asyncCutTag, asyncStopTag };
+	double evaluateSolutionAsync(std::vector<std::vector<double> > const& sol);
+	// wait for target scenarios of the current round, returns the objective
+	double asyncWait(int target);
+	void asyncDispatch(int scen);
+	// receive a result into the bundle, returns its scenario (-1 if none)
+	int asyncReceive();
+	void asyncWorker();
+	void asyncStopWorkers();
 	
 	bundle_t bundle;
 	std::vector<std::vector<double> > currentSolution; // dual solution
@@ -83,6 +108,19 @@ protected:
 	bool terminated_;
 	std::vector<shared_ptr<typename LagrangeSolver::WarmStart> > hotstarts;
 	std::vector<std::vector<variableState> > recourseRowStates, recourseColStates;
+
+	MPI_Comm asyncComm;
+	int asyncRank, asyncWorkers;
+	double asyncFraction;
+	bool partialEvaluation; // objective of the last evaluation includes stale values
+	int asyncRound, asyncReported;
+	std::vector<std::vector<double> > asyncPoint; // point of the current round
+	std::vector<int> asyncQueue;
+	unsigned asyncNext;
+	std::vector<int> idleWorkers;
+	std::vector<int> lastRound; // round in which each scenario was last handed out
+	std::vector<bool> inFlight;
+	std::vector<double> scenObj, scenTime;
 	
 
 
@@ -174,7 +212,7 @@ template<typename B,typename L, typename R> int bundleManager<B,L,R>::solveSubpr
 
 template<typename B, typename L, typename R> double bundleManager<B,L,R>::testPrimal(std::vector<double> const& primal) {
 
-	const std::vector<double> &obj1 = input.getFirstStageObj();
+	const std::vector<double> &obj1 = input.getFirstStageObjView();
 	const std::vector<int> &localScen = ctx.localScenarios();
 	int nvar1 = input.nFirstStageVars();
 	double obj = 0.;
@@ -230,6 +268,8 @@ template<typename B, typename L, typename R> double bundleManager<B,L,R>::testPr
 
 template<typename B, typename L, typename R> double bundleManager<B,L,R>::evaluateSolution(std::vector<std::vector<double> > const& sol, double eps_sol) {
 
+	if (asyncComm != MPI_COMM_NULL) return evaluateSolutionAsync(sol);
+
 	std::vector<int> const& localScen = ctx.localScenarios();
 	int nscen = input.nScenarios();
 	double obj = 0.;
@@ -322,6 +362,11 @@ template<typename B, typename L, typename R> void bundleManager<B,L,R>::iterate(
 
 	assert(!terminated_);
 	
+	if (asyncComm != MPI_COMM_NULL && asyncRank != 0) {
+		asyncWorker();
+		terminated_ = true;
+		return;
+	}
 
 	if (nIter++ == -1) { // just evaluate and generate subgradients
 		evaluateAndUpdate();
@@ -330,7 +375,181 @@ template<typename B, typename L, typename R> void bundleManager<B,L,R>::iterate(
 
 	checkLastPrimals();
 	doStep();
+
+	if (asyncComm != MPI_COMM_NULL && terminated_) {
+		if (partialEvaluation && asyncPoint == currentSolution) {
+			// confirm with the objective of all the scenarios at the current iterate
+			terminated_ = false;
+			currentObj = asyncWait(input.nScenarios());
+		} else {
+			asyncStopWorkers();
+		}
+	}
+	
+}
+
+template<typename B, typename L, typename R> void bundleManager<B,L,R>::setAsynchronous(MPI_Comm comm, double fraction) {
+
+	assert(ctx.nprocs() == 1);
+	assert(fraction > 0. && fraction <= 1.);
+	int nprocs;
+	MPI_Comm_size(comm,&nprocs);
+	if (nprocs == 1) return; // nobody to hand out scenarios to
 	
+	int nscen = input.nScenarios();
+	asyncComm = comm;
+	MPI_Comm_rank(comm,&asyncRank);
+	asyncWorkers = nprocs-1;
+	asyncFraction = fraction;
+	asyncRound = 0;
+	asyncReported = 0;
+	asyncNext = 0;
+	lastRound.assign(nscen,-1);
+	inFlight.assign(nscen,false);
+	scenObj.assign(nscen,0.);
+	scenTime.assign(nscen,0.);
+}
+
+template<typename B, typename L, typename R> double bundleManager<B,L,R>::evaluateSolutionAsync(std::vector<std::vector<double> > const& sol) {
+
+	int nscen = input.nScenarios();
+	
+	// a new round for the scenarios that are not being solved, longest first
+	std::vector<std::pair<double,int> > order;
+	for (int scen = 0; scen < nscen; scen++) {
+		if (!inFlight[scen]) order.push_back(std::make_pair(-scenTime[scen],scen));
+	}
+	std::sort(order.begin(),order.end());
+	asyncQueue.clear();
+	for (unsigned i = 0; i < order.size(); i++) asyncQueue.push_back(order[i].second);
+	asyncNext = 0;
+	asyncRound++;
+	asyncReported = 0;
+	asyncPoint = sol;
+
+	int target = static_cast<int>(ceil(asyncFraction*nscen));
+	return asyncWait(std::max(1,std::min(target,nscen)));
+}
+
+template<typename B, typename L, typename R> double bundleManager<B,L,R>::asyncWait(int target) {
+
+	int nscen = input.nScenarios();
+	while (true) {
+		while (idleWorkers.size() && asyncNext < asyncQueue.size()) {
+			asyncDispatch(asyncQueue[asyncNext++]);
+		}
+		bool done = (asyncReported >= target);
+		// the cutting-plane models need a cut of every scenario
+		for (int scen = 0; done && scen < nscen; scen++) {
+			if (bundle[scen].empty()) done = false;
+		}
+		if (done) break;
+		
+		int scen = asyncReceive();
+		if (scen < 0) continue;
+		if (lastRound[scen] == asyncRound) {
+			asyncReported++;
+		} else {
+			// result for an earlier point, evaluate it at this one too
+			asyncQueue.push_back(scen);
+		}
+	}
+	partialEvaluation = (asyncReported < nscen);
+
+	double obj = 0.;
+	for (int scen = 0; scen < nscen; scen++) obj += scenObj[scen];
+	return obj;
+}
+
+template<typename B, typename L, typename R> void bundleManager<B,L,R>::asyncDispatch(int scen) {
+
+	int nvar1 = input.nFirstStageVars();
+	std::vector<double> buf(nvar1+1);
+	buf[0] = scen;
+	std::copy(asyncPoint[scen].begin(),asyncPoint[scen].end(),buf.begin()+1);
+
+	int w = idleWorkers.back();
+	idleWorkers.pop_back();
+	MPI_Send(&buf[0],nvar1+1,MPI_DOUBLE,w,asyncWorkTag,asyncComm);
+	inFlight[scen] = true;
+	lastRound[scen] = asyncRound;
+}
+
+template<typename B, typename L, typename R> int bundleManager<B,L,R>::asyncReceive() {
+
+	int nvar1 = input.nFirstStageVars();
+	MPI_Status status;
+	MPI_Probe(MPI_ANY_SOURCE,asyncCutTag,asyncComm,&status);
+	int len;
+	MPI_Get_count(&status,MPI_DOUBLE,&len);
+	std::vector<double> buf(std::max(len,1));
+	MPI_Recv(&buf[0],len,MPI_DOUBLE,status.MPI_SOURCE,asyncCutTag,asyncComm,MPI_STATUS_IGNORE);
+	idleWorkers.push_back(status.MPI_SOURCE);
+	if (len == 0) return -1; // first request of a worker
+
+	// scenario, objective, solve time, number of cuts, then the cuts
+	int scen = static_cast<int>(buf[0]);
+	scenObj[scen] = buf[1];
+	scenTime[scen] = buf[2];
+	inFlight[scen] = false;
+	int ncuts = static_cast<int>(buf[3]);
+	assert(len == 4 + ncuts*(2+3*nvar1));
+	const double *p = &buf[4];
+	for (int k = 0; k < ncuts; k++) {
+		cutInfo cut;
+		cut.objval = *p++;
+		cut.objmax = *p++;
+		cut.evaluatedAt.assign(p,p+nvar1); p += nvar1;
+		cut.subgradient.assign(p,p+nvar1); p += nvar1;
+		cut.primalSol.assign(p,p+nvar1); p += nvar1;
+		bundle[scen].push_back(cut);
+	}
+	return scen;
+}
+
+template<typename B, typename L, typename R> void bundleManager<B,L,R>::asyncWorker() {
+
+	int nvar1 = input.nFirstStageVars();
+	std::vector<double> buf(nvar1+1), out;
+	MPI_Status status;
+
+	// an empty result asks for the first scenario
+	MPI_Send(&buf[0],0,MPI_DOUBLE,0,asyncCutTag,asyncComm);
+	while (true) {
+		MPI_Recv(&buf[0],nvar1+1,MPI_DOUBLE,0,MPI_ANY_TAG,asyncComm,&status);
+		if (status.MPI_TAG == asyncStopTag) break;
+
+		int scen = static_cast<int>(buf[0]);
+		std::vector<double> at(buf.begin()+1,buf.end());
+		double obj = 0., t = MPI_Wtime();
+		int ncuts = solveSubproblem(at,scen,obj);
+		t = MPI_Wtime() - t;
+
+		out.clear();
+		out.push_back(scen);
+		out.push_back(obj);
+		out.push_back(t);
+		out.push_back(ncuts);
+		for (unsigned k = bundle[scen].size()-ncuts; k < bundle[scen].size(); k++) {
+			cutInfo const& cut = bundle[scen][k];
+			out.push_back(cut.objval);
+			out.push_back(cut.objmax);
+			out.insert(out.end(),cut.evaluatedAt.begin(),cut.evaluatedAt.end());
+			out.insert(out.end(),cut.subgradient.begin(),cut.subgradient.end());
+			out.insert(out.end(),cut.primalSol.begin(),cut.primalSol.end());
+		}
+		bundle[scen].clear(); // rank 0 keeps the bundle
+		MPI_Send(&out[0],out.size(),MPI_DOUBLE,0,asyncCutTag,asyncComm);
+	}
+}
+
+template<typename B, typename L, typename R> void bundleManager<B,L,R>::asyncStopWorkers() {
+
+	// let the running subproblems finish
+	while (static_cast<int>(idleWorkers.size()) < asyncWorkers) asyncReceive();
+	for (int w = 1; w <= asyncWorkers; w++) {
+		MPI_Send(0,0,MPI_DOUBLE,w,asyncStopTag,asyncComm);
+	}
 }
 
 #endif
@@ -132,6 +132,17 @@ CoinPackedMatrix cuttingPlaneModel::getSecondStageConstraints(int scen) {
 
 }
 
+// same entries as the columns of getSecondStageConstraints
+vector<double> cuttingPlaneModel::getCutColumn(int scen, int k) {
+	vector<double> col(nvar1+1,0.);
+	col[0] = 1.;
+	vector<double> const& subgrad = cuts[scen][k].subgradient;
+	for (unsigned i = 0; i < subgrad.size(); i++) {
+		if (fabs(subgrad[i]) > 1e-7) col[i+1] = -subgrad[i];
+	}
+	return col;
+}
+
 CoinPackedMatrix cuttingPlaneModel::getLinkingConstraints(int scen) {
 	// this is easy, (nvar+1)x(nvar+1) identity matrix!
 	
@@ -88,6 +88,11 @@ public:
 	virtual bool allProbabilitiesEqual() { return true; }
 	virtual bool continuousRecourse() { return true; }
 
+	// column (dense, over the rows of the scenario) and objective of cut k,
+	// for adding a cut to a solver built from an earlier bundle
+	std::vector<double> getCutColumn(int scen, int k);
+	double getCutObj(int scen, int k) { return -cuts[scen][k].computeC(); }
+
 private:
 	int nvar1; // dimension of each \gamma
 	bundle_t const & cuts;
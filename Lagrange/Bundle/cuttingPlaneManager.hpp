@@ -3,7 +3,7 @@
 
 #include "bundleManager.hpp"
 
-#include "cuttingPlaneBALP.hpp"
+#include "cuttingPlaneMaster.hpp"
 
 
 // simple cutting plane approach
@@ -11,16 +11,17 @@
 template<typename BALPSolver, typename LagrangeSolver, typename RecourseSolver>
 class cuttingPlaneManager : public bundleManager<BALPSolver,LagrangeSolver,RecourseSolver> {
 public:
-	cuttingPlaneManager(stochasticInput &input, BAContext & ctx) : bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx) {
-		int nscen = input.nScenarios();
-		rows2.resize(nscen);
-		cols2.resize(nscen);
+	cuttingPlaneManager(stochasticInput &input, BAContext & ctx) : bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx),
+		master(input.nFirstStageVars(),this->bundle,ctx) {
 		t = MPI_Wtime();
 		t2 = 0;
 		lastModelObj = COIN_DBL_MAX;
 	}
 
 
+	// drop cuts that were inactive in the last a solutions of the cutting plane lp (0 keeps all cuts)
+	void setMaxCutAge(int a) { master.setMaxAge(a); }
+
 protected: 
 	virtual void doStep() {
 		using namespace std;
@@ -33,48 +34,10 @@ protected:
 		if (this->ctx.mype() == 0) printf("Iter %d Current Objective: %f Model Objective: %f Elapsed: %f (%f in LP solve)\n",this->nIter-1,this->currentObj,lastModelObj,MPI_Wtime()-t,t2);
 		if (this->terminated_) return;	
 		
-		cuttingPlaneModel cpm(nvar1,this->bundle,-this->bestPrimalObj);
-
-		
-
-		BALPSolver solver(cpm,this->ctx, (this->nIter == 1) ? BALPSolver::useDual : BALPSolver::usePrimal);
-
-		if (this->nIter > 1) {
-			for (int k = 0; k < cpm.nFirstStageVars(); k++) {
-				solver.setFirstStageColState(k,cols1[k]);
-			}
-			for (unsigned r = 1; r < localScen.size(); r++) {
-				int scen = localScen[r];
-				for (int k = 0; k < cpm.nSecondStageCons(scen); k++) {
-					solver.setSecondStageRowState(scen,k,rows2[scen][k]);
-				}
-				cols2[scen].push_back(AtLower);
-				for (int k = 0; k < cpm.nSecondStageVars(scen); k++) {
-					solver.setSecondStageColState(scen,k,cols2[scen][k]);
-				}
-			}
-			solver.commitStates();
-		}
 		double tstart = MPI_Wtime();
-		solver.go();
+		lastModelObj = master.solve(-this->bestPrimalObj);
 		t2 += MPI_Wtime() - tstart;
-		lastModelObj = solver.getObjective();
-
-		cols1.resize(nvar1+1);
-		for (int k = 0; k < nvar1+1; k++) {
-			cols1[k] = solver.getFirstStageColState(k);
-		}
-		for (unsigned r = 1; r < localScen.size(); r++) {
-			int scen = localScen[r];
-			rows2[scen].resize(cpm.nSecondStageCons(scen));
-			for (int k = 0; k < cpm.nSecondStageCons(scen); k++) {
-				rows2[scen][k] = solver.getSecondStageRowState(scen,k);
-			}
-			cols2[scen].resize(cpm.nSecondStageVars(scen));
-			for (int k = 0; k < cpm.nSecondStageVars(scen); k++) {
-				cols2[scen][k] = solver.getSecondStageColState(scen,k);
-			}
-		}
+		BALPSolver &solver = master.getSolver();
 
 		for (unsigned r = 1; r < localScen.size(); r++) {
 			int scen = localScen[r];
@@ -92,9 +55,8 @@ protected:
 private:
 	double lastModelObj;
 	double t, t2;
-	// saved states for cutting plane lp
-	std::vector<std::vector<variableState> > rows2, cols2;
-	std::vector<variableState> cols1;
+	// cutting plane lp, kept across iterations
+	cuttingPlaneMaster<BALPSolver> master;
 
 };
 
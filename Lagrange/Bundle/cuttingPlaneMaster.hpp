@@ -0,0 +1,179 @@
+#ifndef CUTTINGPLANEMASTER_HPP
+#define CUTTINGPLANEMASTER_HPP
+
+#include "bundleManager.hpp"
+#include "cuttingPlaneBALP.hpp"
+
+/*
+The cutting-plane LP (solved as its dual, see cuttingPlaneBALP.hpp) kept in one
+solver across the iterations of a bundle method.
+
+The cuts added to the bundle since the last solve become new second-stage
+columns of the solver, which restarts from its previous basis (the new columns
+are nonbasic at zero, so the basis stays primal feasible). The LP is only
+rebuilt when the lower bound LB changes, because it is in the first-stage
+objective.
+
+If maxAge > 0, cuts whose columns were nonbasic (inactive) in maxAge
+consecutive solutions are deleted from the LP and from the bundle, so that
+column k of a scenario is always cut k of its bundle.
+*/
+template<typename BALPSolver> class cuttingPlaneMaster {
+public:
+	cuttingPlaneMaster(int nvar1, bundle_t &bundle, BAContext &ctx, int maxAge = 0) :
+		nvar1(nvar1), bundle(bundle), ctx(ctx), maxAge(maxAge), LB(0.), nRebuilds(0), nDeleted(0) {
+		int nscen = bundle.size();
+		if (BALPSolver::isDistributed()) {
+			std::vector<int> const& localScen = ctx.localScenarios();
+			scens.assign(localScen.begin()+1,localScen.end());
+		} else {
+			for (int i = 0; i < nscen; i++) scens.push_back(i);
+		}
+		ncols.resize(nscen,0);
+		age.resize(nscen);
+		rows2.resize(nscen);
+		cols2.resize(nscen);
+	}
+
+	void setMaxAge(int a) { maxAge = a; }
+
+	// solve the model of the current bundle, returns the objective
+	double solve(double newLB);
+	BALPSolver& getSolver() { return *solver; }
+
+	int getNumRebuilds() const { return nRebuilds; }
+	int getNumDeleted() const { return nDeleted; }
+
+private:
+	void rebuild();
+	void addNewCuts();
+	void removeAgedCuts(bool fromSolver);
+	void saveStates();
+
+	int nvar1;
+	bundle_t &bundle;
+	BAContext &ctx;
+	int maxAge;
+	double LB;
+	int nRebuilds, nDeleted;
+
+	// scenarios in the LP
+	std::vector<int> scens;
+	shared_ptr<cuttingPlaneModel> model;
+	shared_ptr<BALPSolver> solver;
+	// number of cuts of each scenario in the LP
+	std::vector<int> ncols;
+	// number of consecutive solutions where each cut was nonbasic
+	std::vector<std::vector<int> > age;
+	// states of the last solution, for warm starting a rebuild
+	std::vector<std::vector<variableState> > rows2, cols2;
+	std::vector<variableState> cols1;
+
+};
+
+template<typename BALPSolver> double cuttingPlaneMaster<BALPSolver>::solve(double newLB) {
+
+	bool rebuildNow = (!solver || newLB != LB);
+	if (maxAge > 0) removeAgedCuts(!rebuildNow);
+	if (rebuildNow) {
+		LB = newLB;
+		rebuild();
+	} else {
+		addNewCuts();
+	}
+
+	solver->go();
+	saveStates();
+
+	return solver->getObjective();
+}
+
+template<typename BALPSolver> void cuttingPlaneMaster<BALPSolver>::rebuild() {
+
+	bool first = !solver;
+	solver.reset();
+	model.reset(new cuttingPlaneModel(nvar1,bundle,LB));
+	solver.reset(new BALPSolver(*model,ctx, first ? BALPSolver::useDual : BALPSolver::usePrimal));
+	nRebuilds++;
+
+	if (!first) {
+		for (int k = 0; k < nvar1+1; k++) {
+			solver->setFirstStageColState(k,cols1[k]);
+		}
+		for (unsigned r = 0; r < scens.size(); r++) {
+			int scen = scens[r];
+			for (int k = 0; k < nvar1+1; k++) {
+				solver->setSecondStageRowState(scen,k,rows2[scen][k]);
+			}
+			for (unsigned k = 0; k < bundle[scen].size(); k++) {
+				solver->setSecondStageColState(scen,k,(k < cols2[scen].size()) ? cols2[scen][k] : AtLower);
+			}
+		}
+		solver->commitStates();
+	}
+	for (unsigned r = 0; r < scens.size(); r++) {
+		int scen = scens[r];
+		ncols[scen] = bundle[scen].size();
+	}
+}
+
+template<typename BALPSolver> void cuttingPlaneMaster<BALPSolver>::addNewCuts() {
+
+	for (unsigned r = 0; r < scens.size(); r++) {
+		int scen = scens[r];
+		for (unsigned k = ncols[scen]; k < bundle[scen].size(); k++) {
+			solver->addSecondStageColumn(scen,model->getCutColumn(scen,k),0.,COIN_DBL_MAX,model->getCutObj(scen,k));
+		}
+		ncols[scen] = bundle[scen].size();
+	}
+	solver->commitNewColumns();
+}
+
+template<typename BALPSolver> void cuttingPlaneMaster<BALPSolver>::removeAgedCuts(bool fromSolver) {
+
+	int ndel = 0;
+	for (unsigned r = 0; r < scens.size(); r++) {
+		int scen = scens[r];
+		std::vector<int> del;
+		for (int k = 0; k < ncols[scen]; k++) {
+			if (age[scen][k] >= maxAge) del.push_back(k);
+		}
+		// the convexity row needs at least one cut
+		if (del.empty() || (int)del.size() == ncols[scen]) continue;
+
+		if (fromSolver) solver->deleteSecondStageColumns(scen,del);
+		for (int j = del.size()-1; j >= 0; j--) {
+			bundle[scen].erase(bundle[scen].begin()+del[j]);
+			age[scen].erase(age[scen].begin()+del[j]);
+			cols2[scen].erase(cols2[scen].begin()+del[j]);
+		}
+		ncols[scen] -= del.size();
+		ndel += del.size();
+	}
+	nDeleted += ndel;
+}
+
+template<typename BALPSolver> void cuttingPlaneMaster<BALPSolver>::saveStates() {
+
+	cols1.resize(nvar1+1);
+	for (int k = 0; k < nvar1+1; k++) {
+		cols1[k] = solver->getFirstStageColState(k);
+	}
+	for (unsigned r = 0; r < scens.size(); r++) {
+		int scen = scens[r];
+		rows2[scen].resize(nvar1+1);
+		for (int k = 0; k < nvar1+1; k++) {
+			rows2[scen][k] = solver->getSecondStageRowState(scen,k);
+		}
+		cols2[scen].resize(ncols[scen]);
+		age[scen].resize(ncols[scen],0);
+		for (int k = 0; k < ncols[scen]; k++) {
+			cols2[scen][k] = solver->getSecondStageColState(scen,k);
+			if (cols2[scen][k] == Basic) age[scen][k] = 0;
+			else age[scen][k]++;
+		}
+	}
+}
+
+
+#endif
@@ -79,6 +79,10 @@ public:
 	virtual bool allProbabilitiesEqual() { return true; }
 	virtual bool continuousRecourse() { return true; }
 
+	// column of cut k (dense, over the rows of the scenario), for adding a cut
+	// to a solver built from an earlier bundle
+	std::vector<double> getCutColumn(int scen, int k);
+
 private:
 	int nvar1; // dimension of each \gamma
 	bundle_t const & cuts;
@@ -139,6 +139,16 @@ CoinPackedMatrix lInfTrustModel::getSecondStageConstraints(int scen) {
 
 }
 
+vector<double> lInfTrustModel::getCutColumn(int scen, int k) {
+	vector<double> col(nvar1+1,0.);
+	col[0] = 1.;
+	vector<double> const& subgrad = cuts[scen][k].subgradient;
+	for (unsigned i = 0; i < subgrad.size(); i++) {
+		if (fabs(subgrad[i]) > 1e-7) col[i+1] = -subgrad[i];
+	}
+	return col;
+}
+
 CoinPackedMatrix lInfTrustModel::getLinkingConstraints(int scen) {
 	// [   ]
 	// [ I ]
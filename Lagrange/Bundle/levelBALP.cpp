@@ -149,6 +149,16 @@ CoinPackedMatrix levelModel::getSecondStageConstraints(int scen) {
 
 }
 
+vector<double> levelModel::getCutColumn(int scen, int k) {
+	vector<double> col(2*nvar1+1,0.);
+	col[0] = 1.;
+	vector<double> const& subgrad = cuts[scen][k].subgradient;
+	for (unsigned i = 0; i < subgrad.size(); i++) {
+		if (fabs(subgrad[i]) > 1e-7) col[i+1] = -subgrad[i];
+	}
+	return col;
+}
+
 CoinPackedMatrix levelModel::getLinkingConstraints(int scen) {
 	/* [ -1   ]
            [    I ]
@@ -3,7 +3,8 @@
 
 #include "bundleManager.hpp"
 
-#include "cuttingPlaneBALP.hpp"
+#include "cuttingPlaneMaster.hpp"
+#include "regularizedMaster.hpp"
 #include "levelBALP.hpp"
 
 
@@ -12,12 +13,9 @@ class levelManager : public bundleManager<BALPSolver,LagrangeSolver,RecourseSolv
 public:
 	// levelParameter is \lambda as defined on p.112 "New variants of bundle methods", lemarechal et al.
 	levelManager(stochasticInput &input, BAContext & ctx, double levelParam) : 
-		bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx), levelParam(levelParam) {
-		int nscen = input.nScenarios();
-		rows2.resize(nscen);
-		rows2l.resize(nscen);
-		cols2.resize(nscen);
-		cols2l.resize(nscen);
+		bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx), levelParam(levelParam),
+		master(input.nFirstStageVars(),this->bundle,ctx),
+		levelMaster(input.nFirstStageVars(),this->bundle,this->currentSolution,ctx) {
 		assert(levelParam >= 0. && levelParam <= 1.);
 		bestObj = -COIN_DBL_MAX;
 	}
@@ -39,86 +37,14 @@ protected:
 		
 
 		
-		{
-			cuttingPlaneModel cpm(nvar1,this->bundle,-this->bestPrimalObj);
-			BALPSolver solver(cpm,this->ctx, (this->nIter == 1) ? BALPSolver::useDual : BALPSolver::usePrimal);
-
-			if (this->nIter > 1) {
-				for (int k = 0; k < nvar1+1; k++) {
-					solver.setFirstStageColState(k,cols1[k]);
-				}
-				for (int i = 0; i < nscen; i++) {
-					for (int k = 0; k < nvar1+1; k++) {
-						solver.setSecondStageRowState(i,k,rows2[i][k]);
-					}
-					cols2[i].push_back(AtLower);
-					for (unsigned k = 0; k < this->bundle[i].size(); k++) {
-						solver.setSecondStageColState(i,k,cols2[i][k]);
-					}
-				}
-				solver.commitStates();
-			}
-
-			solver.go();
-			lastModelObj = solver.getObjective();
-
-			cols1.resize(nvar1+1);
-			for (int k = 0; k < nvar1+1; k++) {
-				cols1[k] = solver.getFirstStageColState(k);
-			}
-			for (int i = 0; i < nscen; i++) {
-				rows2[i].resize(nvar1+1);
-				for (int k = 0; k < nvar1+1; k++) {
-					rows2[i][k] = solver.getSecondStageRowState(i,k);
-				}
-				cols2[i].resize(this->bundle[i].size());
-				for (unsigned k = 0; k < this->bundle[i].size(); k++) {
-					cols2[i][k] = solver.getSecondStageColState(i,k);
-				}
-			}
-		}
+		lastModelObj = master.solve(-this->bestPrimalObj);
 
 		double newLevel = levelParam*(-bestObj)+(1.-levelParam)*(-lastModelObj);
 
 		cout << "Target Level = " << -newLevel << endl;
 		{
-			levelModel lm(nvar1,this->bundle,newLevel,this->currentSolution);
-			BALPSolver solver(lm,this->ctx, BALPSolver::useDual);
-			
-			if (this->nIter > 1) {
-				for (int k = 0; k < nvar1+1; k++) {
-					solver.setFirstStageColState(k,cols1l[k]);
-				}
-				for (int i = 0; i < nscen; i++) {
-					for (int k = 0; k < 2*nvar1+1; k++) {
-						solver.setSecondStageRowState(i,k,rows2l[i][k]);
-					}
-					cols2l[i].push_back(AtLower);
-					for (unsigned k = 0; k < 2*nvar1+this->bundle[i].size(); k++) {
-						solver.setSecondStageColState(i,k,cols2l[i][k]);
-					}
-				}
-				solver.commitStates();
-			}
-
-
-
-			solver.go();
-
-			cols1l.resize(nvar1+1);
-			for (int k = 0; k < nvar1+1; k++) {
-				cols1l[k] = solver.getFirstStageColState(k);
-			}
-			for (int i = 0; i < nscen; i++) {
-				rows2l[i].resize(2*nvar1+1);
-				for (int k = 0; k < 2*nvar1+1; k++) {
-					rows2l[i][k] = solver.getSecondStageRowState(i,k);
-				}
-				cols2l[i].resize(2*nvar1+this->bundle[i].size());
-				for (unsigned k = 0; k < 2*nvar1+this->bundle[i].size(); k++) {
-					cols2l[i][k] = solver.getSecondStageColState(i,k);
-				}
-			}
+			levelMaster.solve(newLevel);
+			BALPSolver &solver = levelMaster.getSolver();
 
 			for (int i = 0; i < nscen; i++) {
 				std::vector<double> const& iterate = solver.getSecondStageDualRowSolution(i);
@@ -136,12 +62,10 @@ private:
 	double lastModelObj;
 	double levelParam;
 	double bestObj;
-	// saved states for cutting plane lp
-	std::vector<std::vector<variableState> > rows2, cols2;
-	std::vector<variableState> cols1;
-	// saved states for level set lp
-	std::vector<std::vector<variableState> > rows2l, cols2l;
-	std::vector<variableState> cols1l;
+	// cutting plane and level set lps, kept across iterations. No cuts are
+	// dropped, the two lps share the bundle.
+	cuttingPlaneMaster<BALPSolver> master;
+	regularizedMaster<BALPSolver,levelModel> levelMaster;
 
 
 };
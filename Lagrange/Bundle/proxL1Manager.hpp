@@ -3,7 +3,7 @@
 
 #include "bundleManager.hpp"
 
-#include "cuttingPlaneBALP.hpp"
+#include "regularizedMaster.hpp"
 #include "l1bundleBALP.hpp"
 
 // like levelManager, but only accept a step if it's in the right direction
@@ -11,11 +11,10 @@ template<typename BALPSolver, typename LagrangeSolver, typename RecourseSolver>
 class proxL1Manager : public bundleManager<BALPSolver,LagrangeSolver,RecourseSolver> {
 public:
 	proxL1Manager(stochasticInput &input, BAContext & ctx) : 
-		bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx) {
+		bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx),
+		master(input.nFirstStageVars(),this->bundle,this->currentSolution,ctx) {
 		int nscen = input.nScenarios();
 		trialSolution.resize(nscen,std::vector<double>(input.nFirstStageVars(),0.));
-		rows2l.resize(nscen);
-		cols2l.resize(nscen);
 	}
 
 
@@ -34,44 +33,8 @@ protected:
 		
 
 		{
-			l1bundleModel lm(nvar1,this->bundle,100,this->currentSolution);
-			BALPSolver solver(lm,this->ctx, BALPSolver::useDual);
-			
-			if (this->nIter > 1) {
-				for (int k = 0; k < nvar1+1; k++) {
-					solver.setFirstStageColState(k,cols1l[k]);
-				}
-				for (int i = 0; i < nscen; i++) {
-					for (int k = 0; k < 2*nvar1+1; k++) {
-						solver.setSecondStageRowState(i,k,rows2l[i][k]);
-					}
-					cols2l[i].push_back(AtLower);
-					for (unsigned k = 0; k < 2*nvar1+this->bundle[i].size(); k++) {
-						solver.setSecondStageColState(i,k,cols2l[i][k]);
-					}
-				}
-				solver.commitStates();
-			}
-
-
-
-			solver.go();
-
-			cols1l.resize(nvar1+1);
-			for (int k = 0; k < nvar1+1; k++) {
-				cols1l[k] = solver.getFirstStageColState(k);
-			}
-			for (int i = 0; i < nscen; i++) {
-				rows2l[i].resize(2*nvar1+1);
-				for (int k = 0; k < 2*nvar1+1; k++) {
-					rows2l[i][k] = solver.getSecondStageRowState(i,k);
-				}
-				cols2l[i].resize(2*nvar1+this->bundle[i].size());
-				for (unsigned k = 0; k < 2*nvar1+this->bundle[i].size(); k++) {
-					cols2l[i][k] = solver.getSecondStageColState(i,k);
-				}
-			}
-
+			lastModelObj = master.solve(100);
+			BALPSolver &solver = master.getSolver();
 
 			for (int i = 0; i < nscen; i++) {
 				std::vector<double> const& iterate = solver.getSecondStageDualRowSolution(i);
@@ -96,9 +59,8 @@ protected:
 
 private:
 	double lastModelObj;
-	// saved states for regularized cutting plane lp
-	std::vector<std::vector<variableState> > rows2l, cols2l;
-	std::vector<variableState> cols1l;
+	// regularized cutting plane lp, kept across iterations
+	regularizedMaster<BALPSolver,l1bundleModel> master;
 
 	std::vector<std::vector<double> > trialSolution; 
 
@@ -3,18 +3,17 @@
 
 #include "bundleManager.hpp"
 
-#include "cuttingPlaneBALP.hpp"
+#include "regularizedMaster.hpp"
 #include "l1TrustBALP.hpp"
 
 template<typename BALPSolver, typename LagrangeSolver, typename RecourseSolver>
 class proxL1TrustManager : public bundleManager<BALPSolver,LagrangeSolver,RecourseSolver> {
 public:
 	proxL1TrustManager(stochasticInput &input, BAContext & ctx) : 
-		bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx) {
+		bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx),
+		master(input.nFirstStageVars(),this->bundle,this->currentSolution,ctx) {
 		int nscen = input.nScenarios();
 		trialSolution.resize(nscen,std::vector<double>(input.nFirstStageVars(),0.));
-		rows2l.resize(nscen);
-		cols2l.resize(nscen);
 		maxRadius = input.nFirstStageVars()*nscen;
 		curRadius = maxRadius/1000.;
 		counter = 0;
@@ -33,44 +32,8 @@ protected:
 		
 
 		{
-			l1TrustModel lm(nvar1,this->bundle,curRadius,this->currentSolution);
-			BALPSolver solver(lm,this->ctx, (this->nIter > 1) ? BALPSolver::usePrimal : BALPSolver::useDual);
-			
-			if (this->nIter > 1) {
-				for (int k = 0; k < lm.nFirstStageVars(); k++) {
-					solver.setFirstStageColState(k,cols1l[k]);
-				}
-				for (int i = 0; i < nscen; i++) {
-					for (int k = 0; k < lm.nSecondStageCons(i); k++) {
-						solver.setSecondStageRowState(i,k,rows2l[i][k]);
-					}
-					cols2l[i].push_back(AtLower);
-					for (int k = 0; k < lm.nSecondStageVars(i); k++) {
-						solver.setSecondStageColState(i,k,cols2l[i][k]);
-					}
-				}
-				solver.commitStates();
-			}
-
-
-
-			solver.go();
-			lastModelObj = solver.getObjective();
-
-			cols1l.resize(lm.nFirstStageVars());
-			for (int k = 0; k < lm.nFirstStageVars(); k++) {
-				cols1l[k] = solver.getFirstStageColState(k);
-			}
-			for (int i = 0; i < nscen; i++) {
-				rows2l[i].resize(lm.nSecondStageCons(i));
-				for (int k = 0; k < lm.nSecondStageCons(i); k++) {
-					rows2l[i][k] = solver.getSecondStageRowState(i,k);
-				}
-				cols2l[i].resize(lm.nSecondStageVars(i));
-				for (int k = 0; k < lm.nSecondStageVars(i); k++) {
-					cols2l[i][k] = solver.getSecondStageColState(i,k);
-				}
-			}
+			lastModelObj = master.solve(curRadius);
+			BALPSolver &solver = master.getSolver();
 
 			double sumdiff = 0.;
 			for (int i = 0; i < nscen; i++) {
@@ -118,9 +81,8 @@ private:
 	double lastModelObj;
 	double maxRadius, curRadius;
 	int counter;
-	// saved states for regularized cutting plane lp
-	std::vector<std::vector<variableState> > rows2l, cols2l;
-	std::vector<variableState> cols1l;
+	// trust region lp, kept across iterations
+	regularizedMaster<BALPSolver,l1TrustModel> master;
 
 	std::vector<std::vector<double> > trialSolution; 
 
@@ -3,7 +3,8 @@
 
 #include "bundleManager.hpp"
 
-#include "cuttingPlaneBALP.hpp"
+#include "cuttingPlaneMaster.hpp"
+#include "regularizedMaster.hpp"
 #include "levelBALP.hpp"
 
 // like levelManager, but only accept a step if it's in the right direction
@@ -12,13 +13,11 @@ class proxLevelManager : public bundleManager<BALPSolver,LagrangeSolver,Recourse
 public:
 	// levelParameter is \lambda as defined on p.112 "New variants of bundle methods", lemarechal et al.
 	proxLevelManager(stochasticInput &input, BAContext & ctx, double levelParam) : 
-		bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx), levelParam(levelParam) {
+		bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx), levelParam(levelParam),
+		cpMaster(input.nFirstStageVars(),this->bundle,ctx),
+		levelMaster(input.nFirstStageVars(),this->bundle,this->currentSolution,ctx) {
 		int nscen = input.nScenarios();
 		trialSolution.resize(nscen,std::vector<double>(input.nFirstStageVars(),0.));
-		rows2.resize(nscen);
-		rows2l.resize(nscen);
-		cols2.resize(nscen);
-		cols2l.resize(nscen);
 		assert(levelParam >= 0. && levelParam <= 1.);
 	}
 
@@ -38,44 +37,7 @@ protected:
 		
 
 		
-		{
-			cuttingPlaneModel cpm(nvar1,this->bundle,-this->bestPrimalObj);
-			BALPSolver solver(cpm,this->ctx, (this->nIter == 1) ? BALPSolver::useDual : BALPSolver::usePrimal);
-
-			if (this->nIter > 1) {
-				for (int k = 0; k < nvar1+1; k++) {
-					solver.setFirstStageColState(k,cols1[k]);
-				}
-				for (int i = 0; i < nscen; i++) {
-					for (int k = 0; k < nvar1+1; k++) {
-						solver.setSecondStageRowState(i,k,rows2[i][k]);
-					}
-					cols2[i].push_back(AtLower);
-					for (unsigned k = 0; k < this->bundle[i].size(); k++) {
-						solver.setSecondStageColState(i,k,cols2[i][k]);
-					}
-				}
-				solver.commitStates();
-			}
-
-			solver.go();
-			lastModelObj = solver.getObjective();
-
-			cols1.resize(nvar1+1);
-			for (int k = 0; k < nvar1+1; k++) {
-				cols1[k] = solver.getFirstStageColState(k);
-			}
-			for (int i = 0; i < nscen; i++) {
-				rows2[i].resize(nvar1+1);
-				for (int k = 0; k < nvar1+1; k++) {
-					rows2[i][k] = solver.getSecondStageRowState(i,k);
-				}
-				cols2[i].resize(this->bundle[i].size());
-				for (unsigned k = 0; k < this->bundle[i].size(); k++) {
-					cols2[i][k] = solver.getSecondStageColState(i,k);
-				}
-			}
-		}
+		lastModelObj = cpMaster.solve(-this->bestPrimalObj);
 
 		if (lastModelObj < this->bestPrimalObj - 1e-5) levelParam = 0.5;
 
@@ -83,44 +45,8 @@ protected:
 
 		cout << "Target Level = " << -newLevel << endl;
 		{
-			levelModel lm(nvar1,this->bundle,newLevel,this->currentSolution);
-			BALPSolver solver(lm,this->ctx, BALPSolver::useDual);
-			
-			if (this->nIter > 1) {
-				for (int k = 0; k < nvar1+1; k++) {
-					solver.setFirstStageColState(k,cols1l[k]);
-				}
-				for (int i = 0; i < nscen; i++) {
-					for (int k = 0; k < 2*nvar1+1; k++) {
-						solver.setSecondStageRowState(i,k,rows2l[i][k]);
-					}
-					cols2l[i].push_back(AtLower);
-					for (unsigned k = 0; k < 2*nvar1+this->bundle[i].size(); k++) {
-						solver.setSecondStageColState(i,k,cols2l[i][k]);
-					}
-				}
-				solver.commitStates();
-			}
-
-
-
-			solver.go();
-
-			cols1l.resize(nvar1+1);
-			for (int k = 0; k < nvar1+1; k++) {
-				cols1l[k] = solver.getFirstStageColState(k);
-			}
-			for (int i = 0; i < nscen; i++) {
-				rows2l[i].resize(2*nvar1+1);
-				for (int k = 0; k < 2*nvar1+1; k++) {
-					rows2l[i][k] = solver.getSecondStageRowState(i,k);
-				}
-				cols2l[i].resize(2*nvar1+this->bundle[i].size());
-				for (unsigned k = 0; k < 2*nvar1+this->bundle[i].size(); k++) {
-					cols2l[i][k] = solver.getSecondStageColState(i,k);
-				}
-			}
-
+			levelMaster.solve(newLevel);
+			BALPSolver &solver = levelMaster.getSolver();
 
 			for (int i = 0; i < nscen; i++) {
 				std::vector<double> const& iterate = solver.getSecondStageDualRowSolution(i);
@@ -146,12 +72,10 @@ protected:
 private:
 	double lastModelObj;
 	double levelParam;
-	// saved states for cutting plane lp
-	std::vector<std::vector<variableState> > rows2, cols2;
-	std::vector<variableState> cols1;
-	// saved states for level set lp
-	std::vector<std::vector<variableState> > rows2l, cols2l;
-	std::vector<variableState> cols1l;
+	// cutting plane and level set lps, kept across iterations. No cuts are
+	// dropped, the two lps share the bundle.
+	cuttingPlaneMaster<BALPSolver> cpMaster;
+	regularizedMaster<BALPSolver,levelModel> levelMaster;
 
 	std::vector<std::vector<double> > trialSolution; 
 
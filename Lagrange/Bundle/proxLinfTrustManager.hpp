@@ -3,7 +3,7 @@
 
 #include "bundleManager.hpp"
 
-#include "cuttingPlaneBALP.hpp"
+#include "regularizedMaster.hpp"
 #include "lInfTrustBALP.hpp"
 #include "lInfTrustBALP2.hpp"
 
@@ -12,11 +12,10 @@ template<typename BALPSolver, typename LagrangeSolver, typename RecourseSolver>
 class proxLinfTrustManager : public bundleManager<BALPSolver,LagrangeSolver,RecourseSolver> {
 public:
 	proxLinfTrustManager(stochasticInput &input, BAContext & ctx) : 
-		bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx) {
+		bundleManager<BALPSolver,LagrangeSolver,RecourseSolver>(input,ctx),
+		master(input.nFirstStageVars(),this->bundle,this->currentSolution,ctx) {
 		int nscen = input.nScenarios();
 		trialSolution.resize(nscen,std::vector<double>(input.nFirstStageVars(),0.));
-		rows2l.resize(nscen);
-		cols2l.resize(nscen);
 		maxRadius = 10.;
 		curRadius = maxRadius/10.;
 		counter = 0;
@@ -36,31 +35,10 @@ protected:
 		if (this->terminated_) return;	
 		
 
-		lInfTrustModel lm(nvar1,this->bundle,curRadius,this->currentSolution);
-		BALPSolver solver(lm,this->ctx, (this->nIter > 1) ? BALPSolver::usePrimal : BALPSolver::useDual);
-		
-		if (this->nIter > 1) {
-			for (int k = 0; k < lm.nFirstStageVars(); k++) {
-				solver.setFirstStageColState(k,cols1l[k]);
-			}
-			for (unsigned r = 1; r < localScen.size(); r++) {
-				int scen = localScen[r];
-				for (int k = 0; k < lm.nSecondStageCons(scen); k++) {
-					solver.setSecondStageRowState(scen,k,rows2l[scen][k]);
-				}
-				cols2l[scen].push_back(AtLower);
-				for (int k = 0; k < lm.nSecondStageVars(scen); k++) {
-					solver.setSecondStageColState(scen,k,cols2l[scen][k]);
-				}
-			}
-			solver.commitStates();
-		}
-
-
 		double tstart = MPI_Wtime();
-		solver.go();
+		lastModelObj = master.solve(curRadius);
 		t2 += MPI_Wtime() - tstart;
-		lastModelObj = solver.getObjective();
+		BALPSolver &solver = master.getSolver();
 
 		// sometimes we can get in a loop...
 		if (solver.getNumIterations() == 0) {
@@ -68,23 +46,6 @@ protected:
 			curRadius *= 1.5;
 		}
 
-
-		cols1l.resize(lm.nFirstStageVars());
-		for (int k = 0; k < lm.nFirstStageVars(); k++) {
-			cols1l[k] = solver.getFirstStageColState(k);
-		}
-		for (unsigned r = 1; r < localScen.size(); r++) {
-			int scen = localScen[r];
-			rows2l[scen].resize(lm.nSecondStageCons(scen));
-			for (int k = 0; k < lm.nSecondStageCons(scen); k++) {
-				rows2l[scen][k] = solver.getSecondStageRowState(scen,k);
-			}
-			cols2l[scen].resize(lm.nSecondStageVars(scen));
-			for (int k = 0; k < lm.nSecondStageVars(scen); k++) {
-				cols2l[scen][k] = solver.getSecondStageColState(scen,k);
-			}
-		}
-
 		double maxdifftemp = 0.;
 		for (unsigned r = 1; r < localScen.size(); r++) {
 			int scen = localScen[r];
@@ -135,9 +96,8 @@ private:
 	double maxRadius, curRadius;
 	double t,t2;
 	int counter;
-	// saved states for regularized cutting plane lp
-	std::vector<std::vector<variableState> > rows2l, cols2l;
-	std::vector<variableState> cols1l;
+	// trust region lp, kept across iterations
+	regularizedMaster<BALPSolver,lInfTrustModel> master;
 
 	std::vector<std::vector<double> > trialSolution; 
 
@@ -0,0 +1,112 @@
+#ifndef REGULARIZEDMASTER_HPP
+#define REGULARIZEDMASTER_HPP
+
+#include "bundleManager.hpp"
+
+/*
+The LP of a regularized bundle method (l1bundleModel, l1TrustModel,
+lInfTrustModel or levelModel) kept in one solver across the iterations, as
+cuttingPlaneMaster does for the cutting-plane LP.
+
+In the (dual) LPs of these models each scenario has 2*nvar1 columns for the
+regularization followed by one column per cut, and the center and the
+parameter (weight, trust-region radius or level) only enter the objective.
+So a new center or parameter only changes objective coefficients and the
+cuts added to the bundle since the last solve become new second-stage
+columns, which leaves the previous basis primal feasible. The solver is only
+built once, for the first solve.
+
+Model is constructed as Model(nvar1, bundle, param, center); the bundle and
+the center are referenced, so they have to outlive the master.
+
+Unlike cuttingPlaneMaster, no inactive cuts are dropped (no maxAge): these
+methods only converge with dropped cuts if an aggregate cut replaces them,
+which the models do not have, and the level methods share the bundle with a
+cuttingPlaneMaster.
+*/
+template<typename BALPSolver, typename Model> class regularizedMaster {
+public:
+	regularizedMaster(int nvar1, bundle_t const &bundle, std::vector<std::vector<double> > const &center, BAContext &ctx) :
+		nvar1(nvar1), bundle(bundle), center(center), ctx(ctx) {
+		int nscen = bundle.size();
+		if (BALPSolver::isDistributed()) {
+			std::vector<int> const& localScen = ctx.localScenarios();
+			scens.assign(localScen.begin()+1,localScen.end());
+		} else {
+			for (int i = 0; i < nscen; i++) scens.push_back(i);
+		}
+		obj2.resize(nscen);
+	}
+
+	// solve the model of the current bundle and center with parameter param,
+	// returns the objective
+	double solve(double param);
+	BALPSolver& getSolver() { return *solver; }
+
+private:
+	void update(Model &m);
+
+	int nvar1;
+	bundle_t const &bundle;
+	std::vector<std::vector<double> > const &center;
+	BAContext &ctx;
+
+	// scenarios in the LP
+	std::vector<int> scens;
+	// model the solver was built from
+	shared_ptr<Model> model;
+	shared_ptr<BALPSolver> solver;
+	// objective of the LP, the size of obj2[scen] is the number of
+	// second-stage columns of scen
+	std::vector<double> obj1;
+	std::vector<std::vector<double> > obj2;
+
+};
+
+template<typename BALPSolver, typename Model> double regularizedMaster<BALPSolver,Model>::solve(double param) {
+
+	if (!solver) {
+		model.reset(new Model(nvar1,bundle,param,center));
+		solver.reset(new BALPSolver(*model,ctx,BALPSolver::useDual));
+		obj1 = model->getFirstStageObj();
+		for (unsigned r = 0; r < scens.size(); r++) {
+			int scen = scens[r];
+			obj2[scen] = model->getSecondStageObj(scen);
+		}
+	} else {
+		Model m(nvar1,bundle,param,center);
+		update(m);
+	}
+
+	solver->go();
+
+	return solver->getObjective();
+}
+
+template<typename BALPSolver, typename Model> void regularizedMaster<BALPSolver,Model>::update(Model &m) {
+
+	std::vector<double> c1 = m.getFirstStageObj();
+	for (unsigned k = 0; k < c1.size(); k++) {
+		if (c1[k] != obj1[k]) solver->setFirstStageColObj(k,c1[k]);
+	}
+	obj1.swap(c1);
+
+	for (unsigned r = 0; r < scens.size(); r++) {
+		int scen = scens[r];
+		std::vector<double> c2 = m.getSecondStageObj(scen);
+		int ncols = obj2[scen].size();
+		for (int k = 0; k < ncols; k++) {
+			if (c2[k] != obj2[scen][k]) solver->setSecondStageColObj(scen,k,c2[k]);
+		}
+		// the cuts are the last columns of the model
+		int firstCut = c2.size() - bundle[scen].size();
+		for (unsigned k = ncols; k < c2.size(); k++) {
+			solver->addSecondStageColumn(scen,m.getCutColumn(scen,k-firstCut),0.,COIN_DBL_MAX,c2[k]);
+		}
+		obj2[scen].swap(c2);
+	}
+	solver->commitNewColumns();
+}
+
+
+#endif
@@ -44,6 +44,18 @@ public:
 	virtual CoinPackedMatrix getSecondStageConstraints(int scen) { return inner.getSecondStageConstraints(realScenarios[scen]); }
 	virtual CoinPackedMatrix getLinkingConstraints(int scen) { return inner.getLinkingConstraints(realScenarios[scen]); }
 
+	// the scenario indexes change when scenarios are removed, so the views
+	// come from the inner input instead of the default cache
+	virtual const std::vector<double>& getSecondStageColLBView(int scen) { return inner.getSecondStageColLBView(realScenarios[scen]); }
+	virtual const std::vector<double>& getSecondStageColUBView(int scen) { return inner.getSecondStageColUBView(realScenarios[scen]); }
+	virtual const std::vector<double>& getSecondStageObjView(int scen) { return inner.getSecondStageObjView(realScenarios[scen]); }
+	virtual const std::vector<std::string>& getSecondStageColNamesView(int scen) { return inner.getSecondStageColNamesView(realScenarios[scen]); }
+	virtual const std::vector<double>& getSecondStageRowUBView(int scen) { return inner.getSecondStageRowUBView(realScenarios[scen]); }
+	virtual const std::vector<double>& getSecondStageRowLBView(int scen) { return inner.getSecondStageRowLBView(realScenarios[scen]); }
+	virtual const std::vector<std::string>& getSecondStageRowNamesView(int scen) { return inner.getSecondStageRowNamesView(realScenarios[scen]); }
+	virtual const CoinPackedMatrix& getSecondStageConstraintsView(int scen) { return inner.getSecondStageConstraintsView(realScenarios[scen]); }
+	virtual const CoinPackedMatrix& getLinkingConstraintsView(int scen) { return inner.getLinkingConstraintsView(realScenarios[scen]); }
+
 	void removeScenario(int idx) { rescale -= inner.scenarioProbability(idx);
 		realScenarios.erase(std::find(realScenarios.begin(),realScenarios.end(),idx)); }
 	int realScenarioIdx(int idx) { return realScenarios[idx]; }
@@ -59,7 +71,7 @@ private:
 };
 
 combinedInput combineScenarios(stochasticInput &input, 
-	int nper, bool scenred) {
+	int nper, bool scenred, MPI_Comm comm) {
 
 	int nscen = input.nScenarios(); 
 	stochasticInputSubsetWrapper wrapper(input);
@@ -71,7 +83,7 @@ combinedInput combineScenarios(stochasticInput &input,
 		scenarioMap.resize(nsubproblems+1);
 		int scenthis = std::min(nper,nscen-i);
 		if (scenred && scenthis == nper) {
-			std::vector<int> subproblemScen = fastForwardSelection(wrapper,scenthis);
+			std::vector<int> subproblemScen = fastForwardSelection(wrapper,scenthis,comm);
 			for (int k = 0; k < nper; k++) {
 				scenarioMap[nsubproblems].push_back(wrapper.realScenarioIdx(subproblemScen[k]));
 			}
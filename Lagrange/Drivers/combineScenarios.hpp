@@ -3,9 +3,11 @@
 
 
 #include "combinedInput.hpp"
+#include "mpi.h"
 
+// with scenred, the processes of comm share the scenario reduction
 combinedInput combineScenarios(stochasticInput &input, 
-	int nper, bool scenred);
+	int nper, bool scenred, MPI_Comm comm = MPI_COMM_SELF);
 
 
 #endif
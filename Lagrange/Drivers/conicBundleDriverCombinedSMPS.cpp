@@ -28,7 +28,7 @@ int main(int argc, char **argv) {
 	SMPSInput input(smpsrootname+".cor",smpsrootname+".tim",smpsrootname+".sto");
 
 
-	combinedInput in = combineScenarios(input,nper,true);
+	combinedInput in = combineScenarios(input,nper,true,MPI_COMM_WORLD);
 	conicBundleDriver<CbcLagrangeSolver,CbcRecourseSolver>(in);
 
 	MPI_Finalize();
@@ -5,6 +5,7 @@
 #include "ClpBALPInterface.hpp"
 #include "PIPSSInterface.hpp"
 #include "cuttingPlaneManager.hpp"
+#include <cstdlib>
 
 using namespace std;
 
@@ -16,19 +17,23 @@ int main(int argc, char **argv) {
 	int mype;
 	MPI_Comm_rank(MPI_COMM_WORLD,&mype);
 
-	if (argc != 2) {
-		if (mype == 0) printf("Usage: %s [SMPS root name]\n",argv[0]);
+	if (argc != 2 && argc != 3) {
+		if (mype == 0) printf("Usage: %s [SMPS root name] [async fraction]\n",argv[0]);
 		return 1;
 	}
 
 	string smpsrootname(argv[1]);
+	// with a fraction, rank 0 solves the master problem alone and
+	// the other ranks solve the subproblems asynchronously
+	double asyncFraction = (argc == 3) ? atof(argv[2]) : 0.;
 
 	SMPSInput input(smpsrootname+".cor",smpsrootname+".tim",smpsrootname+".sto");
 	
-	BAContext ctx(MPI_COMM_WORLD);
+	BAContext ctx((asyncFraction > 0.) ? MPI_COMM_SELF : MPI_COMM_WORLD);
 	ctx.initializeAssignment(input.nScenarios());
 
 	cuttingPlaneManager<ClpBALPInterface,ScipLagrangeSolver,ClpRecourseSolver> manager(input,ctx);
+	if (asyncFraction > 0.) manager.setAsynchronous(MPI_COMM_WORLD,asyncFraction);
 
 	while(!manager.terminated()) {
 		manager.iterate();
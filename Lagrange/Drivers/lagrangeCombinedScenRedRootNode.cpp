@@ -38,7 +38,7 @@ int main(int argc, char **argv) {
 
 	if (mype == 0) printf("Initializing data interface\n");
 	scoped_ptr<fakeIntegerWrapper> s(new fakeIntegerWrapper(datarootname,nscen));
-	combinedInput in = combineScenarios(*s,nper,true);
+	combinedInput in = combineScenarios(*s,nper,true,MPI_COMM_WORLD);
 	//combinedInput in = combineScenarios(*s,nper,false);
 
 	lagrangeRootNode<CbcLagrangeSolver,ClpRecourseSolver>(in);
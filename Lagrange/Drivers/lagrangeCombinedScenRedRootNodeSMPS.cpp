@@ -26,7 +26,7 @@ int main(int argc, char **argv) {
 	int nper = atoi(argv[2]);
 
 	SMPSInput input(smpsrootname+".cor",smpsrootname+".tim",smpsrootname+".sto");
-	combinedInput in = combineScenarios(input,nper,true);
+	combinedInput in = combineScenarios(input,nper,true,MPI_COMM_WORLD);
 
 	lagrangeRootNode<CbcLagrangeSolver,CbcRecourseSolver>(in);
 
@@ -46,6 +46,14 @@ public:
   virtual void Dsolve  ( OoqpVector& x ) { solve(x);}
   virtual void Ltsolve ( OoqpVector& x ) {}
 
+  /** true if distinct instances may factor and solve concurrently from
+   *  different threads, i.e., the solver keeps no global state */
+  virtual bool reentrant() const { return false; }
+
+  /** true if matrixChanged overwrites the matrix the solver was created
+   *  with by the factors */
+  virtual bool factorsInPlace() const { return false; }
+
   /** Destructor  */
   virtual ~DoubleLinearSolver() {};
 };
@@ -10,8 +10,9 @@
  * @ingroup AbstractProblemFormulation.
  */
 
+#include "Variables.h"
+
 class Data;
-class Variables;
 
 /**
  * Represents the residuals of a QP when solved by an interior point
@@ -42,6 +43,15 @@ public:
    * gap, given a problem and variable set.  */
   virtual void calcresids(Data *problem, Variables *vars) = 0;
 
+  /** calculate the residuals as calcresids does and return the
+   * complementarity gap mu of vars. Implementations with distributed
+   * vectors may reduce both in one step. */
+  virtual double calcresidsAndMu(Data *problem, Variables *vars)
+  {
+    this->calcresids(problem, vars);
+    return vars->mu();
+  }
+
   /** Modify the "complementarity" component of the residuals, by
    * adding the pairwise products of the complementary variables plus
    * a constant alpha to this term.  
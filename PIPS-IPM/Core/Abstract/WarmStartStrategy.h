@@ -0,0 +1,55 @@
+/* PIPS-IPM                                                           *
+ * Starting an interior-point solve from a previous solution          */
+
+#ifndef WARMSTARTSTRATEGY_H
+#define WARMSTARTSTRATEGY_H
+
+#include "OoqpStartStrategy.h"
+#include "Status.h"
+#include <vector>
+
+/** Starts from a copy of given variables, e.g. the solution of a closely
+ *  related problem. The variables must have the same structure as the
+ *  iterate: same dimensions and distribution, and the same variables and
+ *  rows with lower and upper bounds.
+ *
+ *  A solution has complementary products close to zero, from which the
+ *  interior-point method makes little progress; the bound variables and
+ *  their multipliers are moved back into the interior: first by the
+ *  shift removing any violation, then by centering * sqrt(dnorm) (a
+ *  fraction of the default starting values), and finally by the
+ *  Mehrotra-type adjustment of Solver::stevestart.
+ */
+class WarmStartStrategy : public OoqpStartStrategy {
+public:
+  WarmStartStrategy( Variables * start, double centering = 1.e-3 );
+
+  virtual void doIt( Solver * solver,
+		     ProblemFormulation * formulation,
+		     Variables * iterate, Data * prob,
+		     Residuals * resid, Variables * step );
+protected:
+  Variables * start;
+  double centering;
+};
+
+/** The default status test of the solver, which also reports UNKNOWN
+ *  when a warm-started solve stalls: when the residual norm plus the
+ *  duality gap does not decrease by the factor 'decrease' in 'window'
+ *  iterations, or after maxit iterations (if maxit > 0).
+ */
+class WarmStartStatus : public Status {
+public:
+  WarmStartStatus( int window = 5, double decrease = 0.5, int maxit = 0 );
+
+  virtual int doIt( Solver * solver, Data * data, Variables * vars,
+		    Residuals * resids,
+		    int i, double mu,
+		    int level );
+protected:
+  int window, maxit;
+  double decrease;
+  std::vector<double> phiHistory;
+};
+
+#endif
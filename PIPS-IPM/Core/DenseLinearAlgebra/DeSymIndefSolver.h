@@ -28,6 +28,8 @@ public:
   virtual void matrixChanged();
   virtual void solve ( OoqpVector& vec );
   virtual void solve ( GenMatrix& vec );
+  /** the dense matrix is factored in its storage, a sparse one is copied */
+  virtual bool factorsInPlace() const { return sparseMat==NULL; }
   virtual ~DeSymIndefSolver();
 };
 
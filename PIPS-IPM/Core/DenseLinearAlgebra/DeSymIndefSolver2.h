@@ -23,6 +23,7 @@ public:
   virtual void diagonalChanged( int idiag, int extent );
   virtual void matrixChanged();
   virtual void solve ( OoqpVector& vec );
+  virtual bool factorsInPlace() const { return true; }
   virtual ~DeSymIndefSolver2();
 };
 
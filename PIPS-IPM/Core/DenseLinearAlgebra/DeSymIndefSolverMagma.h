@@ -28,6 +28,7 @@ public:
   virtual void matrixChanged();
   virtual void solve ( OoqpVector& vec );
   virtual void solve ( GenMatrix& vec );
+  virtual bool factorsInPlace() const { return sparseMat==NULL; }
   virtual ~DeSymIndefSolverMagma();
 };
 
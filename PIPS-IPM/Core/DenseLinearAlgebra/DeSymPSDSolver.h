@@ -25,6 +25,7 @@ public:
   virtual void diagonalChanged( int idiag, int extent );
   virtual void matrixChanged();
   virtual void solve ( OoqpVector& x );
+  virtual bool factorsInPlace() const { return true; }
 
   //specialized method that uses BLAS-3 function DTRSM for the triagular solve.
   void Lsolve( DenseGenMatrix& R);
@@ -22,9 +22,15 @@ public:
   int m;
   int n;
   double ** M;
+  /** if nonzero, only the lower triangle M[i][j], j<=i, of a square
+   *  matrix is stored, row by row and contiguously; the operations
+   *  that need entries above the diagonal are not available */
+  int lowerPacked;
 
   DenseStorage( int m, int n );
   DenseStorage( double A[], int m, int n );
+  /** packed==true allocates m*(m+1)/2 doubles in the lowerPacked layout */
+  DenseStorage( int m, int n, bool packed );
 
   virtual ~DenseStorage();
 
@@ -21,6 +21,10 @@ public:
   DenseStorageHandle mStorage;
   
   DenseSymMatrix( int size );
+  /** if lowerPacked is true, only the lower triangle is stored (see
+   *  DenseStorage::lowerPacked); the entries above the diagonal must
+   *  not be accessed */
+  DenseSymMatrix( int size, bool lowerPacked );
   DenseSymMatrix( double Q[], int size );
 
   virtual int isKindOf( int matrixType );
@@ -98,6 +102,8 @@ public:
   
   virtual long long size();
 
+  bool isLowerPacked() const { return mStorage->lowerPacked!=0; }
+
   DenseStorage& getStorageRef() { return *mStorage; }
   DenseStorage*  getStorage() { return mStorage.ptr(); }
 
@@ -165,6 +165,10 @@ public:
    */
   virtual void solve( OoqpVector& rhs ) = 0;
 
+  /** the MA27 with the icntl, cntl and info arguments keeps its state in
+   * the arrays of the instance, not in COMMON blocks */
+  virtual bool reentrant() const { return true; }
+
   /** destructor */
   virtual ~Ma27SolverBase();
 };
@@ -209,6 +213,10 @@ public:
    *
    * @param n dimension of the system */
   virtual void solve( OoqpVector& rhs );
+
+  /** solve with multiple RHS; the right-hand sides are the rows of
+   * the DenseGenMatrix rhs */
+  virtual void solve( GenMatrix& rhs );
 };
 
 #endif
@@ -139,6 +139,8 @@ public:
   virtual void matrixChanged();
   virtual void solve( OoqpVector& rhs );
   virtual void solve( GenMatrix& rhs);
+  /** MA57 keeps its state in the arrays of the instance */
+  virtual bool reentrant() const { return true; }
 
   //virtual void Lsolve  ( OoqpVector& x );
   //virtual void Dsolve  ( OoqpVector& x );
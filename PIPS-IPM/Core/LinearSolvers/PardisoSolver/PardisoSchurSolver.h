@@ -13,6 +13,7 @@
 #include "SparseStorage.h"
 
 #include <map>
+#include <vector>
 
 using namespace std;
 
@@ -46,6 +47,7 @@ protected:
   virtual void matrixChanged();
   virtual void solve( OoqpVector& rhs );
   virtual void solve( GenMatrix& rhs);
+  virtual bool reentrant() const { return true; }
  
   /** Functions specific to the Schur approach. The last argument is the Schur first
    * stage matrix that will be updated.
@@ -83,6 +85,11 @@ protected:
       the diagonal elements of the (1,1) block  in the augmented system */
   map<int,int> diagMap;
 
+  /** fill-reducing ordering of the augmented system, computed by the
+      first analysis and shared through SymbolicCache with the solvers
+      whose augmented systems have the same pattern */
+  vector<int> perm;
+
   //temporary vector of size n
   double* nvec;
   
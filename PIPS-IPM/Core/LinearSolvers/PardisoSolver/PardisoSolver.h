@@ -46,6 +46,7 @@ private:
  // virtual void Lsolve( OoqpVector& x );
  // virtual void Dsolve( OoqpVector& x );
  // virtual void Ltsolve( OoqpVector& x );
+  virtual bool reentrant() const { return true; }
 
  private:
   //Helper functions for when the input is a dense matrix
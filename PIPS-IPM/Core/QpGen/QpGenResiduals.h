@@ -13,6 +13,7 @@
 
 class QpGen;
 class QpGenData;
+class QpGenVars;
 class Variables;
 class LinearAlgebraPackage;
 
@@ -40,6 +41,14 @@ protected:
 
   QpGenResiduals() {};
 
+  /** forms the residuals and reduces the gap, the norms and, if withMu,
+   *  mu with a single ReductionBatch; returns mu (0 if !withMu) */
+  double calcresids(QpGenData *prob, QpGenVars *vars, bool withMu);
+
+  /** r3 = beta * r3 + the pairwise products of the complementary
+   *  variables + alpha, one pass per pair */
+  void form_r3_xz_alpha(QpGenVars *vars, double beta, double alpha);
+
 public:
   OoqpVectorHandle rQ;
   OoqpVectorHandle rA;
@@ -61,6 +70,7 @@ public:
 
 
   virtual void calcresids(Data *problem, Variables *vars);
+  virtual double calcresidsAndMu(Data *problem, Variables *vars);
 
   virtual void add_r3_xz_alpha(Variables *vars, double alpha);
 
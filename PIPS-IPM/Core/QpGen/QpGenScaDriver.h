@@ -20,7 +20,7 @@ using namespace std;
 
 #include "QpGenVars.h"
 #include "QpGenResiduals.h"
-#include "MpsReader.h"
+#include "MpsStreamReader.h"
 #include "SimpleVector.h"
 #include "Status.h"
 #include "QpGenData.h"
@@ -111,7 +111,7 @@ int qpgensca_solve( int argc, char * argv[],
     rusage before_read;
     getrusage( RUSAGE_SELF, &before_read );
 #endif
-    MpsReader * reader  = MpsReader::newReadingFile( filename, iErr );
+    MpsReader * reader  = MpsStreamReader::newReadingFile( filename, iErr );
     if( !reader ) {
       cerr << "Couldn't read file " << filename << endl 
 	   << "For what it is worth, the error number is " << iErr << endl;
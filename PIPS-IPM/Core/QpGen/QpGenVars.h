@@ -11,6 +11,7 @@
 class QpGen;
 class QpGenData;
 class LinearAlgebraPackage;
+class ReductionBatch;
 class MpsReader;
 
 #ifdef TESTING
@@ -79,6 +80,10 @@ public:
   /** computes mu = (t'lambda +u'pi + v'gamma + w'phi)/(mclow+mcupp+nxlow+nxupp) */
   virtual double mu();
 
+  /** adds the local parts of t'lambda +u'pi + v'gamma + w'phi to the
+   *  sum slot of the batch */
+  virtual void batchMu( ReductionBatch& batch, int slot );
+
   virtual double mustep(Variables *step_in, double alpha);
 
   virtual void saxpy( Variables *b, double alpha );
@@ -12,6 +12,7 @@
 #include "sVars.h"
 #include "sTree.h"
 #include "StochMonitor.h"
+#include "WarmStartStrategy.h"
 
 #include <cstdlib>
 
@@ -31,6 +32,15 @@ class PIPSIpmInterface
   void setPrimalTolerance(double val);
   void setDualTolerance(double val);
 
+  /** go() starts from a copy of start, e.g. getVariables() of the
+   *  interface that solved the previous problem of a rolling horizon;
+   *  the problems must have the same structure and distribution. The
+   *  solve is restarted from the default starting point if it stalls,
+   *  see WarmStartStrategy and WarmStartStatus. */
+  void setWarmStart(sVars* start, double centering = 1.e-3);
+  void clearWarmStart();
+  sVars* getVariables() { return vars; }
+
   std::vector<double> getFirstStagePrimalColSolution() const;
   std::vector<double> getSecondStagePrimalColSolution(int scen) const;
   //std::vector<double> getFirstStageDualColSolution() const{};
@@ -50,6 +60,10 @@ class PIPSIpmInterface
 
   IPMSOLVER *   solver;
 
+  sVars *             warmVars;
+  WarmStartStrategy * warmStart;
+  WarmStartStatus *   warmStatus;
+
   PIPSIpmInterface() {};
   MPI_Comm comm;
   
@@ -61,7 +75,8 @@ class PIPSIpmInterface
 
 
 template<class FORMULATION, class IPMSOLVER>
-PIPSIpmInterface<FORMULATION, IPMSOLVER>::PIPSIpmInterface(stochasticInput &in, MPI_Comm comm) : comm(comm)
+PIPSIpmInterface<FORMULATION, IPMSOLVER>::PIPSIpmInterface(stochasticInput &in, MPI_Comm comm) : 
+  warmVars(NULL), warmStart(NULL), warmStatus(NULL), comm(comm)
 {
 
 #ifdef TIMING
@@ -99,7 +114,8 @@ PIPSIpmInterface<FORMULATION, IPMSOLVER>::PIPSIpmInterface(stochasticInput &in,
 }
 
 template<class FORMULATION, class IPMSOLVER>
-PIPSIpmInterface<FORMULATION, IPMSOLVER>::PIPSIpmInterface(StochInputTree* in, MPI_Comm comm) : comm(comm)
+PIPSIpmInterface<FORMULATION, IPMSOLVER>::PIPSIpmInterface(StochInputTree* in, MPI_Comm comm) : 
+  warmVars(NULL), warmStart(NULL), warmStatus(NULL), comm(comm)
 {
 
 #ifdef TIMING
@@ -165,9 +181,25 @@ void PIPSIpmInterface<FORMULATION,IPMSOLVER>::go() {
 #endif
 
   double tmElapsed=MPI_Wtime();
-  //---------------------------------------------
-  int result = solver->solve(data,vars,resids);
-  //---------------------------------------------
+  int result;
+  if(warmStart) {
+    solver->useStartStrategy(warmStart);
+    solver->useStatus(warmStatus);
+    //---------------------------------------------
+    result = solver->solve(data,vars,resids);
+    //---------------------------------------------
+    solver->useStartStrategy(NULL);
+    solver->useStatus(NULL);
+    if(result != SUCCESSFUL_TERMINATION) {
+      if(0 == mype) cout << "Warm start stopped after " << solver->iter 
+			 << " iterations, solving from the default starting point" << endl;
+      result = solver->solve(data,vars,resids);
+    }
+  } else {
+    //---------------------------------------------
+    result = solver->solve(data,vars,resids);
+    //---------------------------------------------
+  }
   tmElapsed=MPI_Wtime()-tmElapsed;
 #ifdef TIMING
   double objective = getObjective();
@@ -208,11 +240,32 @@ double PIPSIpmInterface<FORMULATION,SOLVER>::getFirstStageObjective() const {
 
 
 
+template<class FORMULATION, class IPMSOLVER>
+void PIPSIpmInterface<FORMULATION, IPMSOLVER>::setWarmStart(sVars* start, double centering)
+{
+  clearWarmStart();
+  // the factory keeps the variables it makes (and redistributes them when
+  // the load is balanced), so this copy lives as long as the interface
+  if(!warmVars) warmVars = dynamic_cast<sVars*>( factory->makeVariables( data ) );
+  warmVars->copy(start);
+  warmStart = new WarmStartStrategy(warmVars, centering);
+  warmStatus = new WarmStartStatus();
+}
+
+template<class FORMULATION, class IPMSOLVER>
+void PIPSIpmInterface<FORMULATION, IPMSOLVER>::clearWarmStart()
+{
+  delete warmStatus; warmStatus=NULL;
+  delete warmStart; warmStart=NULL;
+}
+
 template<class FORMULATION, class IPMSOLVER>
 PIPSIpmInterface<FORMULATION, IPMSOLVER>::~PIPSIpmInterface()
 { 
+  clearWarmStart();
   delete solver;
   delete resids;
+  delete warmVars;
   delete vars;
   delete data;
   delete factory;
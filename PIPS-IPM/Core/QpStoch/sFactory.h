@@ -78,11 +78,13 @@ class sFactory : public QpGen {
 
   sResiduals *resid;
   vector<sVars*> registeredVars;
+  vector<sResiduals*> registeredResids;
  
   sLinsysRoot* linsys;
 
   StochIterateResourcesMonitor iterTmMonitor;
   double m_tmTotal;
+  int m_iterNumber;
 };
 
 #endif
@@ -55,6 +55,10 @@ class sLinsys : public QpGenLinsys
   virtual void sync()=0;
   virtual void deleteChildren()=0;
 
+  /** true if this system can be factored and solved concurrently with its
+   * siblings, i.e., its linear solver is reentrant */
+  virtual bool reentrant() const { return solver!=NULL && solver->reentrant(); }
+
  protected:
   sLinsys(){};
 
@@ -84,6 +88,14 @@ class sLinsys : public QpGenLinsys
    */
   virtual void addTermToDenseSchurCompl(sData *prob, 
 					DenseSymMatrix& SC);
+  /** Same as above, but updates only the rows startrow...endrow-1 of SC */
+  virtual void addTermToDenseSchurComplRows(sData *prob, 
+					    DenseSymMatrix& SC,
+					    int startrow, int endrow);
+  /** false if addTermToDenseSchurComplRows adds nothing to the rows
+   *  startrow...endrow-1 of SC; depends only on the sparsity of prob */
+  virtual bool addsToDenseSchurComplRows(sData *prob, 
+					 int startrow, int endrow) { return true; }
 					
   virtual void addColsToDenseSchurCompl(sData *prob, 
 					DenseGenMatrix& out, 
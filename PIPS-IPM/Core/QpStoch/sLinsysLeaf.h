@@ -45,9 +45,38 @@ class sLinsysLeaf : public sLinsys
   //void Ltsolve_internal(  sData *prob, StochVector& x, SimpleVector& xp);
   void sync();
   virtual void deleteChildren();
+
+  /** Adds the term of this scenario to the rows startrow...endrow-1 of
+   *  the Schur complement; only the nonempty linking columns of [R;A;C]
+   *  are solved with and only the corresponding rows and columns of SC
+   *  are updated.
+   */
+  virtual void addTermToDenseSchurComplRows(sData *prob, 
+					    DenseSymMatrix& SC,
+					    int startrow, int endrow);
+  /** true if one of the linking columns startrow...endrow-1 is nonempty */
+  virtual bool addsToDenseSchurComplRows(sData *prob, 
+					 int startrow, int endrow);
  protected:
   sLinsysLeaf() {};
 
+  /** Symbolic pre-pass: finds the linking (first-stage) columns that are
+   *  nonempty in R, A or C and stores these columns in a CSC-like format.
+   *  The sparsity of R, A and C does not change over the IPM iterations,
+   *  so this is done only once, at the first Schur complement assembly.
+   */
+  void computeLinkColsPattern(sData *prob);
+
+  bool linkColsPatternDone;
+  /** indexes of the nonempty linking columns */
+  std::vector<int> linkCols;
+  /** linkColStart[p]..linkColStart[p+1]-1 are the entries of the column linkCols[p] */
+  std::vector<int> linkColStart;
+  /** row of each entry in the (locnx+locmy+locmz) KKT ordering */
+  std::vector<int> linkRow;
+  /** pointer to the value of each entry in the storage of R, A or C */
+  std::vector<double*> linkVal;
+
   static void mySymAtPutSubmatrix(SymMatrix& kkt, 
 				  GenMatrix& B, GenMatrix& D, 
 				  int locnx, int locmy, int locmz);
@@ -60,7 +89,8 @@ sLinsysLeaf::sLinsysLeaf(sFactory *factory_, sData* prob,
 			 OoqpVector* nomegaInv_,
 			 OoqpVector* rhs_,
 			 LINSOLVER* thesolver)
-  : sLinsys(factory_, prob, dd_, dq_, nomegaInv_, rhs_)
+  : sLinsys(factory_, prob, dd_, dq_, nomegaInv_, rhs_),
+    linkColsPatternDone(false)
 {
   //int rank; MPI_Comm_rank(MPI_COMM_WORLD,&rank);
   //double t = MPI_Wtime();
@@ -42,6 +42,14 @@ class sLinsysRoot : public sLinsys {
   /* Atoms methods of FACTOR2 for a non-leaf linear system */
   virtual void initializeKKT(sData* prob, Variables* vars);
   virtual void reduceKKT();
+  /** factors the children, adds their terms and reduces the Schur
+   * complement in a pipelined fashion; replaces the children loops and
+   * reduceKKT when gPipelineSCReduce is set */
+  virtual void addTermsAndReduceKKT(sData* prob, Variables* vars, 
+				    DenseSymMatrix& kktd);
+  /** adds the children terms to the Schur complement, in parallel over
+   * the threads if gThreadScenarios is set */
+  virtual void addTermsToKKT(sData* prob, DenseSymMatrix& kktd);
   virtual void factorizeKKT(); 
   virtual void finalizeKKT(sData* prob, Variables* vars)=0;
 
@@ -60,6 +68,8 @@ class sLinsysRoot : public sLinsys {
   virtual void AddChild(sLinsys* child);
 
   void sync();
+  /** the children of a root system are not threaded over themselves */
+  virtual bool reentrant() const { return false; }
  public:
   virtual ~sLinsysRoot();
 
@@ -71,11 +81,23 @@ class sLinsysRoot : public sLinsys {
   void submatrixAllReduce(DenseSymMatrix* A, 
 			  int row, int col, int drow, int dcol,
 			  MPI_Comm comm);
+  /** number of threads used for the children (1 if gThreadScenarios is
+   * not set, without OpenMP or if a child's solver is not reentrant) */
+  int scenarioThreads();
+ protected:
+  void startPanelReduce(double** M, bool packed, int row, int rowEnd,
+			int b, MPI_Request* req, double** buf,
+			int* bufRow, int* bufRowEnd);
  protected: //buffers
 
   OoqpVector* zDiag;
   OoqpVector* xDiag;
 
+  /** private Schur complements and b0's of the threads 1,2,...; allocated
+   * on the first use and kept for the next iterations */
+  std::vector<DenseSymMatrix*> privSC;
+  std::vector<SimpleVector*> privB0;
+
 #ifdef STOCH_TESTING
  protected: 
   static void dumpRhs(int proc, const char* nameToken,  SimpleVector& rhs);
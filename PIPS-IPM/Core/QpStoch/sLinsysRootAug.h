@@ -12,7 +12,7 @@ class sData;
  */
 class sLinsysRootAug : public sLinsysRoot {
  protected:
-  sLinsysRootAug() {};
+  sLinsysRootAug() : CtDC(NULL), SC(NULL) {};
 
   virtual SymMatrix*   createKKT     (sData* prob);
   virtual DoubleLinearSolver* 
@@ -43,6 +43,10 @@ class sLinsysRootAug : public sLinsysRoot {
 
   SymMatrix* CtDC;
   SimpleVector* redRhs;
+  /** copy of the assembled Schur complement used for the residuals of
+   *  the iterative refinement when gIterRefSCResid is on; only allocated
+   *  if the solver factors kkt in place */
+  DenseSymMatrix* SC;
 };
 
 #endif
@@ -50,6 +50,7 @@ class sTree
 
   void syncStochGenMatrix(StochGenMatrix& mat);
   void syncStochSymMatrix(StochSymMatrix& mat);
+  void syncLocalSizes();
 
   virtual StochSymMatrix*   createQ() const = 0;
   virtual StochVector*      createc() const = 0;
@@ -134,6 +135,9 @@ class sTree
 #endif
 //to be called after assignProcesses
   virtual void loadLocalSizes()=0;
+ protected:
+  //used by syncLocalSizes for the nodes received from other processes
+  virtual void setLocalSizes(int nx, int my, int mz) {};
 };
 
 #endif 
@@ -48,6 +48,8 @@ class sTreeImpl : public sTree
 
   void computeGlobalSizes();
   void loadLocalSizes();
+ protected:
+  void setLocalSizes(int nx, int my, int mz);
  private:
   int m_id;
   stochasticInput& in;
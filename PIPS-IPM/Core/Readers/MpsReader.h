@@ -11,8 +11,23 @@
 #include <cstdio>
 #include "hash.h"
 
-struct MpsRowInfo;
-struct MpsColInfo;
+enum{ DATALINE = 1, HEADERLINE };
+enum{ kBadRowType = -1, kFreeRow, kLessRow, kGreaterRow, kEqualRow,
+        kLessRowWithRange, kGreaterRowWithRange };
+enum { kLowerBound, kUpperBound, kFixedBound, kFreeBound, kMInftyBound, kPInftyBound };
+
+struct MpsRowInfo {
+  char name[17];
+  int  kind;
+  int  nnz;
+};
+
+struct MpsColInfo {
+  char name[17];
+  int  nnz;
+};
+
+int MpsRowTypeFromCode2( char code );
 
 #ifdef TESTING
 class MpsReaderTester;
@@ -127,6 +142,9 @@ protected:
   virtual void expectHeader2( int kindOfLine, const char expectName[],
 			    char line[], int& ierr );
   virtual void remapRows();
+  /** index of the row (column) with the given name, or -1 */
+  virtual int rowIndex( char name[] );
+  virtual int colIndex( char name[] );
   virtual int acceptHeader( int kindOfLine, const char expectName[],
 			    char line[], int& ierr );
   virtual int acceptHeader2( int kindOfLine, const char expectName[],
@@ -0,0 +1,125 @@
+/* PIPS-IPM                                                           *
+ * Single-pass MPS reader working on the file contents in memory      */
+
+#ifndef MPSSTREAMREADER_H
+#define MPSSTREAMREADER_H
+
+#include "MpsReader.h"
+#include <vector>
+#include <cstddef>
+
+/** Open-addressing (linear probing) index of the names of the rows or
+ *  the columns of an MpsReader. The names are not copied, name i is read
+ *  from base + i*stride; like MpsReader, only the first 16 characters of
+ *  a name are significant.
+ */
+class MpsNameIndex {
+public:
+  MpsNameIndex() : base(0), stride(0), mask(0) {}
+
+  /** drop all the names and size the table for n names */
+  void reset( const char* base, size_t stride, int n );
+  /** add name i; returns the index of an equal name already present
+   *  (and does not add i) or -1 */
+  int insert( int i );
+  /** index of the name given by the len characters at s, or -1 */
+  int find( const char* s, int len ) const;
+
+protected:
+  const char* name( int i ) const { return base + i*stride; }
+
+  const char* base;
+  size_t stride;
+  size_t mask;
+  std::vector<int> slots;
+};
+
+/** A reader for the same MPS format as MpsReader, for large files.
+ *
+ *  The file is memory mapped, or inflated into memory if it is gzipped
+ *  (requires HAVE_ZLIB), and the COLUMNS section is parsed only once:
+ *  it is split into chunks at line boundaries that are tokenized in
+ *  parallel by the OpenMP threads, and the entries are kept until
+ *  readQpGen stores them, in compressed row format, directly into the
+ *  SparseStorage of sparse A and C matrices. Names are looked up with an
+ *  MpsNameIndex. The other sections are read with the MpsReader code.
+ */
+class MpsStreamReader : public MpsReader {
+protected:
+  /** file contents; mapped, or held by buffer */
+  char * data;
+  size_t size;
+  bool   mapped;
+  std::vector<char> buffer;
+
+  /** offset of the next line for GetLine */
+  size_t pos;
+  /** offset and line number of the header ending the COLUMNS section */
+  size_t colsEnd;
+  int    colsEndLine;
+
+  MpsNameIndex rowNames, colNames;
+
+  /** the entries of the COLUMNS section read by a chunk, grouped in runs
+   *  of consecutive lines for the same column */
+  struct ColsChunk {
+    std::vector<int>    runStart;   // first entry of each run, and the end
+    std::vector<const char*> runName; // NULL if the column name was omitted
+    std::vector<int>    runNameLen;
+    std::vector<int>    runCol;     // column of each run, set after the scan
+    std::vector<int>    row;
+    std::vector<double> val;
+    int nlines;
+    // the first error: line (relative to the chunk), code, offending token
+    int errLine, err;
+    const char* errTok;
+    int errTokLen;
+  };
+  std::vector<ColsChunk> chunks;
+
+  MpsStreamReader();
+
+  /** map or inflate the file; false if it could not be read */
+  bool load( const char filename[] );
+
+  virtual int GetLine( char * line );
+  virtual int rowIndex( char name[] );
+  virtual int colIndex( char name[] );
+
+  virtual void readRowsSection( char line[], int& iErr, int& return_getline );
+  virtual void scanColsSection( char line[], int& iErr, int& return_getline );
+  virtual void readColsSection( OoqpVector& c,
+				GenMatrix& A, GenMatrix& C,
+				char line[],
+				int& iErr, int& return_getline );
+  virtual void readColsSection( double  c[],
+			        int irowA[], int jcolA[], double dA[],
+				int irowC[], int jcolC[], double dC[],
+				char line[],
+				int& iErr, int& return_getline );
+
+  /** the first line start at or after p (and not before from) */
+  size_t lineStart( size_t from, size_t p ) const;
+  /** offset of the first header line starting in [from, to), or size */
+  size_t findHeader( size_t from, size_t to ) const;
+  void parseColsChunk( size_t from, size_t to, ColsChunk& chunk ) const;
+  /** number the columns and count the entries of the rows */
+  void numberColumns( int& iErr );
+  /** the objective into c and the rows of A and C in compressed row
+   *  format, with increasing column indexes in each row */
+  void fillRows( double c[],
+		 int krowA[], int jcolA[], double dA[],
+		 int krowC[], int jcolC[], double dC[] );
+  /** continue with the header line ending the COLUMNS section */
+  void skipToColsEnd( char line[], int& kindOfLine );
+
+public:
+  /** Creates a new MpsStreamReader for the file, see
+   *  MpsReader::newReadingFile. */
+  static MpsStreamReader * newReadingFile( char filename[], int& iErr );
+
+  virtual void releaseFile( int& ierr );
+  virtual ~MpsStreamReader();
+};
+
+#endif
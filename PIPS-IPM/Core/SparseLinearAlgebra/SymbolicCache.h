@@ -0,0 +1,53 @@
+/* PIPS-IPM                                                           *
+ * Cache of symbolic analyses of sparse symmetric patterns            */
+
+#ifndef SYMBOLICCACHE_H
+#define SYMBOLICCACHE_H
+
+#include <vector>
+
+/** Symbolic analyses (orderings and the data the factorizations derive
+ *  from them) of sparse matrices, shared by the linear solvers of a
+ *  process that factor matrices with the same sparsity pattern, e.g. the
+ *  scenarios of a stochastic problem or consecutive solves in batch mode.
+ *
+ *  An entry is keyed by the name of the solver and the pattern, given as
+ *  row pointers (n+1) and column indexes (nnz) in the solver's own
+ *  convention. Patterns are compared in full, the hash is only used to
+ *  find the candidates.
+ *
+ *  Controlled by gSymbolicCache: 0 disables the cache, 1 keeps the
+ *  entries in memory, 2 also writes them to and reads them from files in
+ *  the directory gSymbolicCacheDir so that later runs can reuse them.
+ *
+ *  At most gSymbolicCacheMaxEntries entries are kept in memory, the
+ *  least recently used ones are dropped first.
+ *
+ *  The cache may be used by solvers running in concurrent OpenMP threads
+ *  (gThreadScenarios); all the methods are serialized.
+ *
+ *  @ingroup SparseLinearAlgebra
+ */
+class SymbolicCache {
+public:
+  /** true if the cache is enabled (gSymbolicCache > 0) */
+  static bool enabled();
+
+  /** Copy the analysis stored for the pattern into analysis; false if
+   *  there is none. */
+  static bool find( const char* solver, int n,
+		    const int* rowptr, const int* colidx,
+		    std::vector<int>& analysis );
+
+  /** Store the analysis of the pattern, replacing the one stored. */
+  static void insert( const char* solver, int n,
+		      const int* rowptr, const int* colidx,
+		      const std::vector<int>& analysis );
+
+  /** Drop all the entries kept in memory. */
+  static void clear();
+
+  static int hits, misses;
+};
+
+#endif
@@ -111,6 +111,28 @@ public:
   virtual void copyFromArray( double v[] );
   virtual void copyFromArray( char v[] );
 
+  virtual void axzpyAddSome( double beta, OoqpVector& x, OoqpVector& z,
+			     double c, OoqpVector& select );
+  virtual void pairAxpy( double alpha, OoqpVector& mystep,
+			 OoqpVector& y, OoqpVector& ystep );
+
+  /** The children add their local parts; the parts of 'vec', which is
+   *  replicated on all processes, are added to sums by the first process
+   *  of mpiComm only. */
+  virtual void batchDotProductWith( OoqpVector& v,
+				    ReductionBatch& batch, int slot );
+  virtual void batchShiftedDotProductWith( double alpha, OoqpVector& mystep,
+					   OoqpVector& yvec,
+					   double beta,  OoqpVector& ystep,
+					   ReductionBatch& batch, int slot );
+  virtual void batchInfnorm( ReductionBatch& batch, int slot );
+  virtual void batchStepbound( OoqpVector & v,
+			       ReductionBatch& batch, int slot );
+  virtual void batchFindBlocking( OoqpVector & wstep_vec,
+				  OoqpVector & u_vec,
+				  OoqpVector & ustep_vec,
+				  ReductionBatch& batch, int slot );
+
   int getSize() { return n; };
 };
 
@@ -203,6 +225,25 @@ public:
   virtual void copyFromArray( double v[] ){};
   virtual void copyFromArray( char v[] ){};
 
+  virtual void axzpyAddSome( double beta, OoqpVector& x, OoqpVector& z,
+			     double c, OoqpVector& select ){};
+  virtual void pairAxpy( double alpha, OoqpVector& mystep,
+			 OoqpVector& y, OoqpVector& ystep ){};
+
+  virtual void batchDotProductWith( OoqpVector& v,
+				    ReductionBatch& batch, int slot ){};
+  virtual void batchShiftedDotProductWith( double alpha, OoqpVector& mystep,
+					   OoqpVector& yvec,
+					   double beta,  OoqpVector& ystep,
+					   ReductionBatch& batch, int slot ){};
+  virtual void batchInfnorm( ReductionBatch& batch, int slot ){};
+  virtual void batchStepbound( OoqpVector & v,
+			       ReductionBatch& batch, int slot ){};
+  virtual void batchFindBlocking( OoqpVector & wstep_vec,
+				  OoqpVector & u_vec,
+				  OoqpVector & ustep_vec,
+				  ReductionBatch& batch, int slot ){};
+
   int getSize() { return 0; };
 };
 
@@ -14,6 +14,8 @@ using namespace std;
 #include "IotrRefCount.h"
 #include "OoqpVectorHandle.h"
 
+class ReductionBatch;
+
 /** An abstract class representing the implementation of a OoqpVector. 
  *
  *  Do not create instances of OoqpVector. Create instance of subclasses 
@@ -200,6 +202,37 @@ public:
 			      double *ustep_elt,
 			      int& first_or_second) = 0;
 
+  /** Fused update of the complementarity residual:
+   *  this = beta * this + x * z + c on the entries where select is
+   *  nonzero (beta == 0 does not read this). Same as scale, axzpy and
+   *  addSomeConstants, in one pass over the data. */
+  virtual void axzpyAddSome( double beta, OoqpVector& x, OoqpVector& z,
+			     double c, OoqpVector& select );
+
+  /** Fused update of a pair of complementary variables:
+   *  this += alpha * mystep and y += alpha * ystep, in one pass. */
+  virtual void pairAxpy( double alpha, OoqpVector& mystep,
+			 OoqpVector& y, OoqpVector& ystep );
+
+  /** Deferred versions of dotProductWith, shiftedDotProductWith,
+   *  infnorm, stepbound and findBlocking: the local contribution is added
+   *  to the given slot of the batch, and the result is available after
+   *  batch.reduce(). The default implementations are for vectors that
+   *  are not distributed. */
+  virtual void batchDotProductWith( OoqpVector& v,
+				    ReductionBatch& batch, int slot );
+  virtual void batchShiftedDotProductWith( double alpha, OoqpVector& mystep,
+					   OoqpVector& yvec,
+					   double beta,  OoqpVector& ystep,
+					   ReductionBatch& batch, int slot );
+  virtual void batchInfnorm( ReductionBatch& batch, int slot );
+  virtual void batchStepbound( OoqpVector & v,
+			       ReductionBatch& batch, int slot );
+  virtual void batchFindBlocking( OoqpVector & wstep_vec,
+				  OoqpVector & u_vec,
+				  OoqpVector & ustep_vec,
+				  ReductionBatch& batch, int slot );
+
   /** Copy the elements of this OoqpVector into the C-style array v. */
   virtual void copyIntoArray( double v[] ) const = 0;
   /** Copy the elements of the C-style array v into this OoqpVector. */
@@ -0,0 +1,73 @@
+/* PIPS-IPM                                                           *
+ * Deferred reductions of vector norms, dot products and step bounds  */
+
+#ifndef REDUCTIONBATCH_H
+#define REDUCTIONBATCH_H
+
+#include "mpi.h"
+#include <vector>
+
+/** A batch of scalar reductions over the processes that own the parts of a
+ *  distributed vector.
+ *
+ *  The caller reserves slots, the vectors add their local contributions to
+ *  the slots (see OoqpVector::batchDotProductWith and friends) and
+ *  reduce() combines all slots with one MPI_Allreduce. Slot values are
+ *  only global after reduce(); before it they hold the local partial
+ *  results.
+ *
+ *  The communicator is set by the first distributed vector that adds to
+ *  the batch; a batch without one is not communicated at all.
+ *
+ *  @ingroup AbstractLinearAlgebra
+ */
+class ReductionBatch {
+public:
+  ReductionBatch();
+
+  /** Reserve a slot holding a sum, initially zero. */
+  int sumSlot();
+  /** Reserve a slot holding a maximum, initially init. */
+  int maxSlot( double init );
+  /** Reserve a slot holding a minimum, initially init. */
+  int minSlot( double init );
+  /** Reserve a slot holding a blocking step length, initially maxStep,
+   *  and the components of the blocking element (see
+   *  OoqpVector::findBlocking). Ties among processes are resolved as in
+   *  StochVector::findBlocking by taking the largest components. */
+  int blockingSlot( double maxStep );
+
+  void addSum( int slot, double val );
+  void updateMax( int slot, double val );
+  void updateMin( int slot, double val );
+
+  /** Return the value of the slot (local before reduce, global after). */
+  double value( int slot ) const;
+
+  /** The step and the blocking components of a blocking slot; updated in
+   *  place by the vectors. */
+  double& blockingStep( int slot );
+  double* blockingElements( int slot );
+  int&    blockingFirstOrSecond( int slot );
+
+  /** Use comm for the reduction unless a communicator was already set. */
+  void setComm( MPI_Comm comm );
+
+  /** Reduce all the slots among the processes. */
+  void reduce();
+
+protected:
+  enum { kSum=0, kMax, kMin, kBlocking };
+
+  // kind and position in the arrays below of each slot
+  std::vector<int> slotKind, slotIndex;
+  // sums; maxima and negated minima; blocking records
+  std::vector<double> sums, maxs;
+  std::vector<double> blocks;
+  std::vector<int>    blockFirstOrSecond;
+
+  MPI_Comm comm;
+  bool reduced;
+};
+
+#endif
@@ -86,6 +86,10 @@ public:
   virtual int matchesNonZeroPattern( OoqpVector& select );
   virtual void selectNonZeros( OoqpVector& select );
   virtual void addSomeConstants( double c, OoqpVector& select );
+  virtual void axzpyAddSome( double beta, OoqpVector& x, OoqpVector& z,
+			     double c, OoqpVector& select );
+  virtual void pairAxpy( double alpha, OoqpVector& mystep,
+			 OoqpVector& y, OoqpVector& ystep );
   virtual void writefSomeToStream( ostream& out,
 				   const char format[],
 				   OoqpVector& select ) const;
@@ -16,6 +16,8 @@
 
 using namespace std;
 
+extern int gSymbolicCache;
+
 
 int main(int argc, char ** argv) {
   MPI_Init(&argc, &argv);
@@ -63,6 +65,9 @@ int main(int argc, char ** argv) {
   datarootname=ss.str();
   //printf("mype=[%d][%d] datarootname=%s nscen=%d\n", mype, mynewpe, datarootname.c_str(), nscen);
 
+  // the scenarios of a batch share their structure; analyse it once
+  gSymbolicCache=1;
+
   rawInput* s = new rawInput(datarootname,nscen, commBatch);
 
   PIPSIpmInterface<sFactoryAug, MehrotraStochSolver> pipsIpm(*s, commBatch);
@@ -0,0 +1,245 @@
+/* PIPS-IPM                                                           *
+ * Batch-serving version of pipsipmBatchFromRaw                       */
+
+/* Solves the batches of pipsipmBatchFromRaw from a queue instead of with
+ * one fixed communicator per batch. Rank 0 keeps the queue and the other
+ * ranks form a pool: a batch is given to as many idle ranks as it has
+ * scenarios (up to [max procs per batch]), which build a communicator for
+ * it and go back to the pool as soon as it is solved and saved. The
+ * largest batches are started first; smaller ones use the ranks left idle
+ * meanwhile, until the batch at the head of the queue has been passed over
+ * maxHeadBypass times: then the idle ranks are kept for it.
+ */
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "rawInput.hpp"
+#include "PIPSIpmInterface.h"
+
+#include "sFactoryAugSchurLeaf.h"
+#include "MehrotraStochSolver.h"
+
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+extern int gSymbolicCache;
+
+// worker -> rank 0: idle; leader -> rank 0: result of a batch;
+// rank 0 -> worker: [batch, nscen, nprocs, ranks] or batch -1 to stop
+const int tagReady=1, tagResult=2, tagWork=3;
+
+// number of smaller batches started while the head of the queue waits for
+// idle ranks, before the ranks are reserved for the head
+const int maxHeadBypass=4;
+
+struct BatchJob {
+  int batch, nscen, nprocs;
+  bool operator<(const BatchJob& o) const {
+    return nscen>o.nscen || (nscen==o.nscen && batch<o.batch);
+  }
+};
+
+static string batchRootName(const string& datadirname, const string& datarootname, int batch)
+{
+  stringstream ss; ss << datadirname << batch << "/" << datarootname;
+  return ss.str();
+}
+
+// the number of scenario files root1, root2, ... of the batch
+static int countScenarios(const string& rootname)
+{
+  int n=0;
+  for(;;) {
+    stringstream ss; ss << rootname << (n+1);
+    if(access(ss.str().c_str(), R_OK)) break;
+    n++;
+  }
+  return n;
+}
+
+static void saveVector(const string& fname, const std::vector<double>& v)
+{
+  ofstream f(fname.c_str());
+  for(size_t i=0; i<v.size(); i++)
+    f << v[i] << endl;
+  f.close();
+}
+
+static void solveBatch(const string& rootname, const string& outputdir,
+		       int batch, int nscen, MPI_Comm commBatch)
+{
+  int mynewpe; MPI_Comm_rank(commBatch, &mynewpe);
+  double tstart = MPI_Wtime();
+
+  rawInput* s = new rawInput(rootname, nscen, commBatch);
+  PIPSIpmInterface<sFactoryAug, MehrotraStochSolver> pipsIpm(*s, commBatch);
+  delete s;
+  pipsIpm.go();
+
+  for(int sc=0; sc<nscen; sc++) {
+    std::vector<double> duals = pipsIpm.getSecondStageDualRowSolution(sc);
+    if(duals.size()) {
+      stringstream ss1; ss1 << outputdir << "/batch-" << batch << "-out_duals_scen" << (sc+1) << ".txt";
+      saveVector(ss1.str(), duals);
+    }
+    std::vector<double> primals = pipsIpm.getSecondStagePrimalColSolution(sc);
+    if(primals.size()) {
+      stringstream ss2; ss2 << outputdir << "/batch-" << batch << "-out_primals_scen" << (sc+1) << ".txt";
+      saveVector(ss2.str(), primals);
+    }
+  }
+  if(mynewpe==0) {
+    stringstream ss1; ss1 << outputdir << "/batch-" << batch << "-out_primal_1stStage.txt";
+    saveVector(ss1.str(), pipsIpm.getFirstStagePrimalColSolution());
+    stringstream ss2; ss2 << outputdir << "/batch-" << batch << "-out_dual_1stStage.txt";
+    saveVector(ss2.str(), pipsIpm.getFirstStageDualRowSolution());
+  }
+
+  double totalObjective=pipsIpm.getObjective();
+  int nprocs; MPI_Comm_size(commBatch, &nprocs);
+  // the batch is done when all its ranks have saved their solutions
+  MPI_Barrier(commBatch);
+  if(mynewpe==0) {
+    double res[5] = { (double)batch, (double)nscen, (double)nprocs,
+		      totalObjective, MPI_Wtime()-tstart };
+    MPI_Send(res, 5, MPI_DOUBLE, 0, tagResult, MPI_COMM_WORLD);
+  }
+}
+
+static void worker(const string& datadirname, const string& datarootname,
+		   const string& outputdir, int mype)
+{
+  MPI_Group worldGroup; MPI_Comm_group(MPI_COMM_WORLD, &worldGroup);
+  int nprocs; MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+  std::vector<int> work(3+nprocs);
+
+  double ready = mype;
+
+  for(;;) {
+    MPI_Send(&ready, 1, MPI_DOUBLE, 0, tagReady, MPI_COMM_WORLD);
+    MPI_Status status;
+    MPI_Recv(&work[0], work.size(), MPI_INT, 0, tagWork, MPI_COMM_WORLD, &status);
+    int batch=work[0], nscen=work[1], nbatchprocs=work[2];
+    if(batch<0) break;
+
+    // only the ranks of the batch take part in creating its communicator
+    MPI_Group group; MPI_Comm commBatch;
+    MPI_Group_incl(worldGroup, nbatchprocs, &work[3], &group);
+    MPI_Comm_create_group(MPI_COMM_WORLD, group, batch, &commBatch);
+    MPI_Group_free(&group);
+    assert(commBatch!=MPI_COMM_NULL);
+
+    solveBatch(batchRootName(datadirname, datarootname, batch), outputdir,
+	       batch, nscen, commBatch);
+    MPI_Comm_free(&commBatch);
+  }
+  MPI_Group_free(&worldGroup);
+}
+
+static void dispatcher(std::vector<BatchJob>& queue, int nprocs)
+{
+  int nworkers = nprocs-1, nbatch = queue.size(), nsolved = 0;
+  double tstart = MPI_Wtime();
+  std::sort(queue.begin(), queue.end());
+
+  std::vector<int> idle;
+  std::vector<int> work(3+nprocs);
+  int headBypassed = 0;
+  while(nsolved<nbatch || (int)idle.size()<nworkers) {
+    MPI_Status status;
+    double res[5];
+    MPI_Recv(res, 5, MPI_DOUBLE, MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &status);
+    if(status.MPI_TAG==tagResult) {
+      nsolved++;
+      printf("batch %d: %d scenarios on %d procs, TotalObjective=%g, %.2f sec [%d/%d]\n",
+	     (int)res[0], (int)res[1], (int)res[2], res[3], res[4], nsolved, nbatch);
+      fflush(stdout);
+      continue;
+    }
+    assert(status.MPI_TAG==tagReady);
+    idle.push_back(status.MPI_SOURCE);
+
+    // start the first batches of the queue that fit in the idle ranks
+    std::sort(idle.begin(), idle.end());
+    for(size_t q=0; q<queue.size() && idle.size()>0; ) {
+      BatchJob& job = queue[q];
+      if(q>0 && headBypassed>=maxHeadBypass) break;
+      if(job.nprocs>(int)idle.size()) { q++; continue; }
+      if(q>0) headBypassed++; else headBypassed=0;
+
+      work[0]=job.batch; work[1]=job.nscen; work[2]=job.nprocs;
+      for(int p=0; p<job.nprocs; p++) work[3+p]=idle[p];
+      for(int p=0; p<job.nprocs; p++)
+	MPI_Send(&work[0], 3+job.nprocs, MPI_INT, idle[p], tagWork, MPI_COMM_WORLD);
+      idle.erase(idle.begin(), idle.begin()+job.nprocs);
+      queue.erase(queue.begin()+q);
+    }
+  }
+
+  work[0]=-1;
+  for(int p=1; p<nprocs; p++)
+    MPI_Send(&work[0], 3, MPI_INT, p, tagWork, MPI_COMM_WORLD);
+
+  double elapsed = MPI_Wtime()-tstart;
+  printf("%d batches solved in %.2f sec: %.1f problems/hour\n",
+	 nsolved, elapsed, elapsed>0 ? 3600.*nsolved/elapsed : 0.);
+}
+
+int main(int argc, char ** argv) {
+  MPI_Init(&argc, &argv);
+  int mype; MPI_Comm_rank(MPI_COMM_WORLD,&mype);
+
+  if(argc<6) {
+    if (mype == 0) printf("Usage: %s [rawdump batches directory] [rawdump root name] [num batches] [num scenarios per batch, 0 to count the files] [output dir] [max procs per batch (default: all)]\n", argv[0]);
+    MPI_Finalize();
+    return 1;
+  }
+
+  string datadirname(argv[1]);
+  string datarootname(argv[2]);
+  int nbatch = atoi(argv[3]);
+  int nscen = atoi(argv[4]);
+  string outputdir(argv[5]);
+
+  int nprocs; MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+  int maxprocs = nprocs-1;
+  if(argc>6) maxprocs = std::min(maxprocs, atoi(argv[6]));
+  if(nprocs<2 || maxprocs<1) {
+    if(mype == 0) cout << "At least 2 procs are needed: rank 0 only dispatches the batches" << endl;
+    MPI_Finalize();
+    return 1;
+  }
+
+  // the scenarios of a batch share their structure, and often the batches
+  // too; a rank keeps the most recently used analyses of the batches it
+  // solves (at most gSymbolicCacheMaxEntries)
+  gSymbolicCache=1;
+
+  if(mype==0) {
+    cout << argv[0] << " starting ..." << endl;
+    std::vector<BatchJob> queue;
+    for(int b=1; b<=nbatch; b++) {
+      BatchJob job;
+      job.batch = b;
+      job.nscen = nscen>0 ? nscen : countScenarios(batchRootName(datadirname, datarootname, b));
+      if(job.nscen<1) {
+	cout << "No scenarios found for batch " << b << ", skipped" << endl;
+	continue;
+      }
+      job.nprocs = std::min(job.nscen, maxprocs);
+      queue.push_back(job);
+    }
+    dispatcher(queue, nprocs);
+  } else {
+    worker(datadirname, datarootname, outputdir, mype);
+  }
+
+  MPI_Finalize();
+  return 0;
+}
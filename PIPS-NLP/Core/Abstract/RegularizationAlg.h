@@ -23,6 +23,11 @@ public:
 
   int num_PrimReg;
   int num_DualReg;
+
+  /** factorizations of the full system, and of single blocks with block
+   *  inertia correction, done by the last factorization */
+  int num_FactTrials;
+  int num_BlockTrials;
   
   RegularizationAlg();
 
@@ -34,6 +39,12 @@ public:
   virtual int
   computeRegularization(double &priReg, double &dualReg, const double mu=0)=0;
 
+  /** the next primal shift to try when the inertia of a single block is
+   *  corrected, given the current one (0 on the first trial); a
+   *  negative value stops the correction of the block */
+  virtual double
+  nextBlockRegularization(double priReg) { return -1.; }
+
 };
 
 #endif
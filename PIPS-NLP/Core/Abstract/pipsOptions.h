@@ -142,6 +142,13 @@ class pipsOptions
   */
   int UseDualRegAlg;
 
+  /* inertia correction of the stochastic KKT system
+	* 0: every trial regularizes and refactors all the blocks
+	* 1: on the first trial, a scenario block or the first-stage Schur complement with the
+	*    wrong inertia is regularized and refactored on its own; the other factors are kept
+  */
+  int BlockInertiaCorrection;
+
 
   /* -------- is NLP or QP/LP--------  */
   int isNLP; 			//   0: is QP/LP  (1): is NLP
@@ -38,6 +38,11 @@ public:
 
   virtual int ObjGrad( NlpGenVars * vars, OoqpVector *grad ) = 0;
 
+  /** objective value and gradient in one call, so that implementations
+   *  evaluating the model by parts can fuse their reductions; returns as ObjGrad */
+  virtual int ObjValueAndGrad( NlpGenVars * vars, OoqpVector *grad, double& obj )
+  { obj = ObjValue( vars ); return ObjGrad( vars, grad ); }
+
   
 
   virtual void Hessian( NlpGenVars * vars, SymMatrix *Hess ) = 0;
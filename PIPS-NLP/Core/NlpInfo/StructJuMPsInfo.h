@@ -26,6 +26,8 @@ public:
 
 	virtual int ObjGrad(NlpGenVars * vars, OoqpVector *grad);
 
+	virtual int ObjValueAndGrad(NlpGenVars * vars, OoqpVector *grad, double& obj);
+
 	virtual void Hessian(NlpGenVars * vars, SymMatrix *Hess);
 
 	virtual void JacFull(NlpGenVars * vars, GenMatrix* JacA, GenMatrix* JacC);
@@ -39,6 +41,19 @@ public:
 	virtual void writeSolution(NlpGenVars* vars);
 
 	int nodeId();
+
+protected:
+	/** threads evaluating the children of this node; 1 unless the callbacks
+	 *  were declared thread safe with PipsNlpProblemStructSetEvalThreads */
+	int evalThreads();
+
+	/** gradients (and objectives if obj is not NULL) of the children; their
+	 *  first-stage contributions are added to pgrad and obj */
+	void childrenObjGrad(NlpGenVars * vars, OoqpVector *grad, double *pgrad, double *obj);
+
+	/** childrenObjGrad with one eval_f_grad_batch call; returns false if the
+	 *  callback is not given or declined, then nothing was changed */
+	bool childrenObjGradBatch(NlpGenVars * vars, OoqpVector *grad, double *pgrad, double *obj);
 };
 
 
@@ -38,6 +38,9 @@ public:
   virtual int
   computeRegularization(double &priReg, double &dualReg, const double mu);
 
+  virtual double
+  nextBlockRegularization(double priReg);
+
 private:
 
   virtual double
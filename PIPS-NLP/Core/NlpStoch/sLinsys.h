@@ -12,6 +12,7 @@
 #include "OoqpVectorHandle.h"
 #include "DenseSymMatrix.h"
 #include "SparseSymMatrixRowMajList.h"
+#include "SparseSymSchurCSR.h"
 #include "DenseGenMatrix.h"
 #include "SimpleVector.h"
 #include "StochVector.h"
@@ -108,6 +109,12 @@ class sLinsys : public NlpGenLinsys
 					DenseSymMatrix& SC);
   virtual void addTermToDenseSchurCompl(sData *prob, 
 					SparseSymMatrixRowMajList& SC);
+  /** The same term for a Schur complement with a fixed pattern: the
+   *  pattern of the term is added first by addTermToSchurComplPattern */
+  virtual void addTermToSchurComplPattern(sData *prob, 
+					  SparseSymSchurCSR& SC);
+  virtual void addTermToSparseSchurCompl(sData *prob, 
+					 SparseSymSchurCSR& SC);
   virtual void addColsToDenseSchurCompl(sData *prob, 
 					DenseGenMatrix& out, 
 					int startcol, int endcol);
@@ -124,6 +131,17 @@ class sLinsys : public NlpGenLinsys
 
   virtual int GetNegEigVal(){return solver->negEigVal;};
 
+  /** Inertia correction of this block alone (gBlockInertiaCorrection):
+   *  shift the primal diagonal of the block and refactor it until it has
+   *  my+mz negative eigenvalues. negEVal is the result of the last
+   *  factorization; returns the new one, or negEVal if the block is not
+   *  corrected on its own. */
+  virtual int correctInertia(int negEVal, RegularizationAlg* RegInfo) { return negEVal; }
+
+  /** return and reset the number of trial factorizations done by
+   *  correctInertia in this subtree */
+  virtual int takeInertiaTrials();
+
   virtual void _backSolve(sData *prob, OoqpVector& ParSol_ , OoqpVector& Vec_, StochVector* End_Par_Pos_);
 
   virtual void _addTargetParsLnizi(sData *prob, OoqpVector& ParSol_ , OoqpVector& Vec_, OoqpVector* goal_Par); 
@@ -142,6 +160,18 @@ class sLinsys : public NlpGenLinsys
   sTree* stochNode;
 
   bool isActive;
+
+ protected:
+  /** scpart = - Gi inv(H_i) Gi^T for the columns start,...,start+numcols-1
+   *  (scpart[j-start][i] is entry (i,j)); false if these columns of Gi^T
+   *  are zero and scpart was not computed */
+  bool schurComplColBlock(sData *prob, int start, int numcols,
+			  DenseGenMatrix& cols, DenseGenMatrix& scpart);
+
+  /** trial factorizations done by correctInertia */
+  int inertiaTrials;
+  /** set by factor() while the children may correct their inertia */
+  RegularizationAlg* blockRegInfo;
 };
 
 #endif
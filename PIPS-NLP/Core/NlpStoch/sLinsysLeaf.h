@@ -48,6 +48,7 @@ class sLinsysLeaf : public sLinsys
   virtual ~sLinsysLeaf();
 
   virtual int factor2( sData *prob, Variables *vars);
+  virtual int correctInertia(int negEVal, RegularizationAlg* RegInfo);
   virtual void Lsolve ( sData *prob, OoqpVector& x );
   virtual void Dsolve ( sData *prob, OoqpVector& x );
   virtual void Ltsolve( sData *prob, OoqpVector& x );
@@ -67,6 +67,8 @@ class sLinsysRoot : public sLinsys {
 
   virtual void AddChild(sLinsys* child);
 
+  virtual int takeInertiaTrials();
+
   void sync();
  public:
   virtual ~sLinsysRoot();
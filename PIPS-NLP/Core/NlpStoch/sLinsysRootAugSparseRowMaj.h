@@ -7,13 +7,14 @@
 
 #include "sLinsysRootAug.h"
 #include "SparseSymMatrixRowMajList.h"
+#include "SparseSymSchurCSR.h"
 class sData;
 /** 
  * ROOT (= NON-leaf) linear system in reduced augmented form
  */
 class sLinsysRootAugSpTriplet : public sLinsysRootAug {
  protected:
-  sLinsysRootAugSpTriplet() {};
+  sLinsysRootAugSpTriplet() : sc(NULL) {};
 
   virtual SymMatrix*   createKKT(sData* prob);
   virtual DoubleLinearSolver* createSolver(sData* prob, 
@@ -42,6 +43,9 @@ class sLinsysRootAugSpTriplet : public sLinsysRootAug {
   virtual void UpdateMatrices( Data * prob_in,int const updateLevel=2);
  protected:
   bool iAmRank0;
+  /** the children terms of the Schur complement, with the pattern set at
+   *  the first factorization; reduced to rank 0 and added to kkt there */
+  SparseSymSchurCSR* sc;
 };
 
 #endif
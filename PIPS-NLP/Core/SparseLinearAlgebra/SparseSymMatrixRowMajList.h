@@ -114,6 +114,11 @@ class SparseSymMatrixRowMajList : public SymMatrix {
   virtual void atAddSpRow(const int& row, std::list<ColVal>& colvalSrc);
   virtual void atAddSpRow(const int& row, int* jcolSrc, double* M, const int& nelems);
 
+  /** addresses of the entries (row,jcolSrc[k]) of the lower triangle, inserted
+   *  as zeros if missing; jcolSrc is ordered. Entries are never removed, so
+   *  the addresses stay valid for the life of the matrix */
+  void atGetSpRowPtrs(const int& row, const int* jcolSrc, const int& nelems, double** ptrs);
+
   void symAtAddSubmatrix( int destRow, int destCol,
 			  DoubleMatrix& Mat,
 			  int srcRow, int srcCol,
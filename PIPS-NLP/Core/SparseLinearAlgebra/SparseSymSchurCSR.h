@@ -0,0 +1,68 @@
+/* PIPS-NLP                                                           *
+ * Sparse Schur complement with a fixed pattern, for assembly         */
+
+#ifndef SPARSESYMSCHURCSR_H
+#define SPARSESYMSCHURCSR_H
+
+#include "SparseSymMatrixRowMajList.h"
+#include <vector>
+#include "mpi.h"
+
+/** Lower triangle of a sparse symmetric Schur complement in compressed
+ *  row format (sorted column indexes), with a pattern that is set once.
+ *
+ *  The pattern is built from the dense blocks the children contribute
+ *  to (the first-stage columns of their borders), then made the union
+ *  over the processes with reducePattern. Afterwards the contributions
+ *  are only added into the value array, which is reduced among the
+ *  processes as a plain buffer.
+ */
+class SparseSymSchurCSR {
+public:
+  SparseSymSchurCSR( int n );
+
+  int size() const { return n; }
+  int numberOfNonZeros() const { return krow[n]; }
+  bool hasPattern() const { return patternSet; }
+
+  /** add the lower triangle of the dense block idx x idx to the pattern;
+   *  idx is sorted */
+  void addDenseBlockToPattern( const std::vector<int>& idx );
+  /** the pattern becomes the union of the patterns of the processes of
+   *  comm; collective, called once */
+  void reducePattern( MPI_Comm comm );
+
+  int* krowM() { return &krow[0]; }
+  int* jcolM() { return jcol.size() ? &jcol[0] : NULL; }
+  double* M() { return vals.size() ? &vals[0] : NULL; }
+
+  void setToZero();
+
+  /** add the block B of columns start,...,start+ncols-1 (B[(j-start)*ldb+i]
+   *  is entry (i,j)) to the entries of the pattern in the lower triangle */
+  void atAddColBlock( int start, int ncols, const double* B, int ldb );
+
+  /** sum the values of the processes of comm on root */
+  void reduce( int root, MPI_Comm comm );
+
+  /** add the entries to the lower triangle of M. The entries of M are
+   *  located (inserted if missing) on the first call for M; afterwards the
+   *  values are added through the saved addresses */
+  void addTo( SparseSymMatrixRowMajList& M );
+
+protected:
+  /** pattern of the rows of the local blocks, until reducePattern */
+  void addToPattern( const int* krowSrc, const int* jcolSrc );
+  void compressPattern();
+
+  int n;
+  std::vector<int> krow, jcol;
+  std::vector<double> vals;
+  std::vector<std::vector<int> > rows;
+  bool patternSet;
+  // matrix of the last addTo and the addresses of the entries in it
+  SparseSymMatrixRowMajList* dest;
+  std::vector<double*> destPtr;
+};
+
+#endif
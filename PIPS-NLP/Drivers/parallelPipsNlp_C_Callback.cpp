@@ -89,6 +89,8 @@ CreatePipsNlpProblemStruct(
 	retval->objective = 0.0;
 	retval->nvars = 0;
 	retval->ncons = 0;
+	retval->eval_threads = 1;
+	retval->eval_f_grad_batch = NULL;
 	return retval;
 }
 
@@ -190,6 +192,20 @@ void FreePipsNlpProblemStruct(PipsNlpProblemStruct* prob){
   delete prob;
 }
 
+extern "C"
+void PipsNlpProblemStructSetEvalThreads(PipsNlpProblemStruct* prob, int nthreads)
+{
+  if(prob)
+    prob->eval_threads = nthreads > 1 ? nthreads : 1;
+}
+
+extern "C"
+void PipsNlpProblemStructSetEvalFGradBatch(PipsNlpProblemStruct* prob, str_eval_f_grad_batch_cb eval_f_grad_batch)
+{
+  if(prob)
+    prob->eval_f_grad_batch = eval_f_grad_batch;
+}
+
 extern "C"
 int get_x(CallBackDataPtr data,double* x, double* lam_eq, double* lam_ieq)
 {
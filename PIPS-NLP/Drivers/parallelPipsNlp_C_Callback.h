@@ -131,6 +131,20 @@ extern "C" typedef int (*str_eval_h_cb)(double* x0, double* x1, double* lamdba,
 		int* nz, double* elts, int* rowidx, int *colptr,
 		CallBackDataPtr cbd);
 
+/*
+ * Optional batched evaluation of the objectives and their gradients of the second stage nodes of a process,
+ * see PipsNlpProblemStructSetEvalFGradBatch. For the node node_ids[k], k=0..nnodes-1, it computes
+ * 	obj[k]   as eval_f does for this node (obj is NULL when only the gradients are requested),
+ * 	grad0[k] as eval_grad_f does for the row and col node id pair (node_ids[k],0),
+ * 	grad1[k] as eval_grad_f does for the row and col node id pair (node_ids[k],node_ids[k]).
+ * x0 are the first stage variable values and x1[k] the values of the variables of node node_ids[k].
+ * prob is the userdata field of the PipsNlpProblemStruct.
+ *
+ * It returns 1 if the nodes were evaluated; otherwise PIPS-NLP evaluates them one by one with eval_f and eval_grad_f.
+ */
+extern "C" typedef int (*str_eval_f_grad_batch_cb)(int nnodes, int* node_ids, double* x0, double** x1,
+		double* obj, double** grad0, double** grad1, UserDataPtr prob);
+
 /*
  * write solution when it is done.
  */
@@ -156,6 +170,12 @@ extern "C"
     double objective;
     int nvars;
     int ncons;
+    // number of threads evaluating the scenarios of a process, see
+    // PipsNlpProblemStructSetEvalThreads
+    int eval_threads;
+    // batched objective and gradient of the scenarios, NULL if not given,
+    // see PipsNlpProblemStructSetEvalFGradBatch
+    str_eval_f_grad_batch_cb eval_f_grad_batch;
   };
   typedef struct PipsNlpProblemStruct* PipsNlpProblemStructPtr; 	/** Pointer to a pips_nlp Problem. **/
 
@@ -177,6 +197,20 @@ extern "C"
 
   int PipsNlpSolveStruct(PipsNlpProblemStruct* prob);
 
+  /*
+   * Evaluate the scenarios of each process on nthreads OpenMP threads
+   * (default 1). The callbacks are then called concurrently for different
+   * node ids and must be thread safe; the default is safe for any callbacks.
+   */
+  void PipsNlpProblemStructSetEvalThreads(PipsNlpProblemStruct* prob, int nthreads);
+
+  /*
+   * Evaluate the objectives and gradients of the scenarios of each process with one call of
+   * eval_f_grad_batch instead of one eval_f and two eval_grad_f calls per scenario.
+   * Passing NULL restores the per-scenario callbacks (the default).
+   */
+  void PipsNlpProblemStructSetEvalFGradBatch(PipsNlpProblemStruct* prob, str_eval_f_grad_batch_cb eval_f_grad_batch);
+
   /*
    * Get primal-dual solution corresponding to node Id specified in the CallBackData.
    * The vector for primal (x) and dual variables (lam_eq and lam_ieq) should be allocated
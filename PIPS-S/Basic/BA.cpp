@@ -48,6 +48,37 @@ int BAContext::reduce(int d) const {
 }
 
 
+// MPI operator and datatype for BAMaxLoc, created on first use
+static MPI_Op maxlocOp = MPI_OP_NULL;
+static MPI_Datatype maxlocType = MPI_DATATYPE_NULL;
+
+static void maxlocReduce(void *in, void *inout, int *len, MPI_Datatype *) {
+	BAMaxLoc *a = static_cast<BAMaxLoc*>(in);
+	BAMaxLoc *b = static_cast<BAMaxLoc*>(inout);
+	for (int i = 0; i < *len; i++) {
+		if (a[i].val > b[i].val || (a[i].val == b[i].val && a[i].rank < b[i].rank)) {
+			b[i] = a[i];
+		}
+	}
+}
+
+BAMaxLoc BAContext::maxloc(double val, BAIndex idx, const double *aux, int naux) const {
+	assert(naux >= 0 && naux <= BAMAXLOC_NAUX);
+	if (maxlocOp == MPI_OP_NULL) {
+		MPI_Type_contiguous(sizeof(BAMaxLoc),MPI_BYTE,&maxlocType);
+		MPI_Type_commit(&maxlocType);
+		MPI_Op_create(&maxlocReduce,1,&maxlocOp);
+	}
+	BAMaxLoc my, best;
+	my.val = val;
+	my.rank = _mype;
+	my.idx = idx;
+	for (int i = 0; i < BAMAXLOC_NAUX; i++) my.aux[i] = (i < naux) ? aux[i] : 0.0;
+	MPI_Allreduce(&my,&best,1,maxlocType,maxlocOp,mpicomm);
+	return best;
+}
+
+
 int BAContext::owner(int scen) const {
 	if (scen == -1) return 0;
 	else return (assignedScen.at(scen));
@@ -24,6 +24,17 @@ struct BAIndex {
 	bool operator==(const BAIndex&r) const { return (idx == r.idx && scen == r.scen); }
 };
 
+// result of a fused argmax over all processes (see BAContext::maxloc)
+// the process with the largest val wins, ties go to the lowest rank;
+// idx and aux are the winner's
+#define BAMAXLOC_NAUX 2
+struct BAMaxLoc {
+	double val;
+	int rank;
+	BAIndex idx;
+	double aux[BAMAXLOC_NAUX];
+};
+
 // communication context class
 // contains MPI communicator
 // handles logic for assigning scenarios
@@ -41,6 +52,10 @@ public:
 	// reduce (sum) a single value (convenience functions)
 	double reduce(double in) const;
 	int reduce(int in) const;
+	// argmax of val over all processes, returns the winning index
+	// and up to BAMAXLOC_NAUX values attached to it by its owner
+	// in a single allreduce (instead of MAXLOC followed by broadcasts)
+	BAMaxLoc maxloc(double val, BAIndex idx, const double *aux = 0, int naux = 0) const;
 
 	int mype() const { return _mype; }
 	int nprocs() const { return _nprocs; }
@@ -82,32 +82,32 @@ BAData::BAData(stochasticInput &input, BAContext &ctx) : ctx(ctx) {
 	names.allocate(dims, ctx, PrimalVector);
 
 
-	formBAVector(l, input.getFirstStageColLB(),
-			bind(&stochasticInput::getSecondStageColLB,&input,_1),
-			input.getFirstStageRowLB(),
-			bind(&stochasticInput::getSecondStageRowLB,&input,_1),ctx);
-
-	formBAVector(u, input.getFirstStageColUB(),
-			bind(&stochasticInput::getSecondStageColUB,&input,_1),
-			input.getFirstStageRowUB(),
-			bind(&stochasticInput::getSecondStageRowUB,&input,_1),ctx);
-
-	formBAVector(c, input.getFirstStageObj(),
-			bind(&stochasticInput::getSecondStageObj,&input,_1),
+	formBAVector(l, input.getFirstStageColLBView(),
+			bind(&stochasticInput::getSecondStageColLBView,&input,_1),
+			input.getFirstStageRowLBView(),
+			bind(&stochasticInput::getSecondStageRowLBView,&input,_1),ctx);
+
+	formBAVector(u, input.getFirstStageColUBView(),
+			bind(&stochasticInput::getSecondStageColUBView,&input,_1),
+			input.getFirstStageRowUBView(),
+			bind(&stochasticInput::getSecondStageRowUBView,&input,_1),ctx);
+
+	formBAVector(c, input.getFirstStageObjView(),
+			bind(&stochasticInput::getSecondStageObjView,&input,_1),
 			vector<double>(input.nFirstStageCons(),0.0),
 			emptyRowVector(input), ctx);
 
-	formBAVector(names, input.getFirstStageColNames(),
-			bind(&stochasticInput::getSecondStageColNames,&input,_1),
-			input.getFirstStageRowNames(),
-			bind(&stochasticInput::getSecondStageRowNames,&input,_1),ctx);
+	formBAVector(names, input.getFirstStageColNamesView(),
+			bind(&stochasticInput::getSecondStageColNamesView,&input,_1),
+			input.getFirstStageRowNamesView(),
+			bind(&stochasticInput::getSecondStageRowNamesView,&input,_1),ctx);
 
 	for (unsigned i = 0; i < localScen.size(); i++) {
 		int scen = localScen[i];
 		checkConstraintType(l.getVec(scen),u.getVec(scen),vartype.getVec(scen));
 	}
 
-	Acol.reset(new CoinPackedMatrix(input.getFirstStageConstraints()));
+	Acol.reset(new CoinPackedMatrix(input.getFirstStageConstraintsView()));
 	Arow.reset(new CoinPackedMatrix());
 	Arow->reverseOrderedCopyOf(*Acol);
 
@@ -139,11 +139,11 @@ BAData::BAData(stochasticInput &input, BAContext &ctx) : ctx(ctx) {
 	} else {*/
 		for (int i = 0; i < nscen; i++) {
 			if (!ctx.assignedScenario(i)) continue;
-			Tcol[i].reset(new CoinPackedMatrix(input.getLinkingConstraints(i)));
+			Tcol[i].reset(new CoinPackedMatrix(input.getLinkingConstraintsView(i)));
 			Trow[i].reset(new CoinPackedMatrix());
 			Trow[i]->reverseOrderedCopyOf(*Tcol[i]);
 
-			Wcol[i].reset(new CoinPackedMatrix(input.getSecondStageConstraints(i)));
+			Wcol[i].reset(new CoinPackedMatrix(input.getSecondStageConstraintsView(i)));
 			Wrow[i].reset(new CoinPackedMatrix());
 			Wrow[i]->reverseOrderedCopyOf(*Wcol[i]);
 		}
@@ -395,6 +395,62 @@ void BAData::multiply(const denseBAVector &in, sparseBAVector &out, const BAFlag
 
 //#define PIPSPROF
 
+// true if PRICE for one scenario touches fewer elements column-wise, i.e.,
+// with all of Wcol and Tcol, than row-wise with the rows of Wrow and Trow
+// selected by the nonzeros of in2
+static bool priceColumnwise(const CoinPackedMatrix &Wrow, const CoinPackedMatrix &Trow,
+		const CoinPackedMatrix &Wcol, const CoinPackedMatrix &Tcol,
+		const CoinIndexedVector &in2) {
+	CoinBigIndex colWork = Wcol.getNumElements() + Tcol.getNumElements() +
+		Wcol.getMajorDim() + Tcol.getMajorDim();
+	const int *in2Idx = in2.getIndices();
+	int nnzIn2 = in2.getNumElements();
+	CoinBigIndex rowWork = 0;
+	for (int j = 0; j < nnzIn2; j++) {
+		int row = in2Idx[j];
+		rowWork += Wrow.getVectorSize(row) + Trow.getVectorSize(row) + 1;
+		if (rowWork > colWork) return true;
+	}
+	return false;
+}
+
+// column-wise PRICE for one scenario: out2 = [W -I]^T in2, out1 += T^T in2
+static void multiplyTColumnwise(const CoinPackedMatrix &Wcol, const CoinPackedMatrix &Tcol,
+		const CoinIndexedVector &in2, CoinIndexedVector &out2, CoinIndexedVector &out1,
+		int nvarReal2) {
+	const double *in2Elts = in2.denseVector();
+	const int *in2Idx = in2.getIndices();
+	int nnzIn2 = in2.getNumElements();
+
+	const double *WcolElts = Wcol.getElements();
+	const int *WcolIdx = Wcol.getIndices();
+	for (int col = 0; col < nvarReal2; col++) {
+		double work = 0.0;
+		CoinBigIndex end = Wcol.getVectorLast(col);
+		for (CoinBigIndex q = Wcol.getVectorFirst(col); q < end; q++) {
+			work += WcolElts[q]*in2Elts[WcolIdx[q]];
+		}
+		if (work) out2.quickInsert(col,work);
+	}
+	// slacks
+	for (int j = 0; j < nnzIn2; j++) {
+		int row = in2Idx[j];
+		out2.quickInsert(nvarReal2+row,-in2Elts[row]);
+	}
+
+	const double *TcolElts = Tcol.getElements();
+	const int *TcolIdx = Tcol.getIndices();
+	int ncolT = Tcol.getMajorDim();
+	for (int col = 0; col < ncolT; col++) {
+		double work = 0.0;
+		CoinBigIndex end = Tcol.getVectorLast(col);
+		for (CoinBigIndex q = Tcol.getVectorFirst(col); q < end; q++) {
+			work += TcolElts[q]*in2Elts[TcolIdx[q]];
+		}
+		if (work) out1.quickAdd(col,work);
+	}
+}
+
 void BAData::multiplyT(const sparseBAVector &in, sparseBAVector &out) const {
 	// assume out is cleared
 
@@ -411,18 +467,31 @@ void BAData::multiplyT(const sparseBAVector &in, sparseBAVector &out) const {
 #ifdef PIPSPROF
 	MPI_Barrier(ctx.comm());
 	double local_t = MPI_Wtime();
+	int ncolumnwise = 0;
 #endif
 
 	for (unsigned i = 1; i < localScen.size(); i++) {
 		int scen = localScen[i];
 
 		const CoinIndexedVector &in2 = in.getSecondStageVec(scen).v;
+		int nnzIn2 = in2.getNumElements();
+		// nothing from this scenario
+		if (nnzIn2 == 0) continue;
+
 		CoinIndexedVector &out2 = out.getSecondStageVec(scen).v;
 		const double *in2Elts = in2.denseVector();
 		const int* in2Idx = in2.getIndices();
 
 		int nvarReal2 = dims.inner.numSecondStageVars(scen);
-		int nnzIn2 = in2.getNumElements();
+
+		// choose row- or column-wise from the work of this block
+		if (priceColumnwise(*Wrow[scen],*Trow[scen],*Wcol[scen],*Tcol[scen],in2)) {
+			multiplyTColumnwise(*Wcol[scen],*Tcol[scen],in2,out2,out1Send,nvarReal2);
+#ifdef PIPSPROF
+			ncolumnwise++;
+#endif
+			continue;
+		}
 
 		const double *WrowElts = Wrow[scen]->getElements();
 		const int *WrowIdx = Wrow[scen]->getIndices();
@@ -495,9 +564,12 @@ void BAData::multiplyT(const sparseBAVector &in, sparseBAVector &out) const {
 	double maxlocaltime;
 	MPI_Reduce(&local_t,&totallocaltime,1,MPI_DOUBLE,MPI_SUM,0,ctx.comm());
 	MPI_Reduce(&local_t,&maxlocaltime,1,MPI_DOUBLE,MPI_MAX,0,ctx.comm());
+	int totalcolumnwise;
+	MPI_Reduce(&ncolumnwise,&totalcolumnwise,1,MPI_INT,MPI_SUM,0,ctx.comm());
 	int nproc = ctx.nprocs();
 	double idealtotal = totallocaltime/nproc + first_t;
 	if (ctx.mype() == 0) {
+		printf("PRICE column-wise scenarios: %d\n", totalcolumnwise);
 		printf("PRICE ideal total: %g actual total: %g load imbalance: %f comm. cost: %f 1st stage cost: %f\n",
 			idealtotal,maxlocaltime+comm_t + first_t,
 			100.*(maxlocaltime-totallocaltime/nproc)/idealtotal,
@@ -808,13 +880,19 @@ int BAData::addFirstStageColumn( double lb, double ub, double cobj){
 
 int BAData::addSecondStageColumn(int scen,double lb, double ub, double cobj){
 
-	assert(scen >= 0 && scen < dims.numScenarios());
-	int returnIndex= -1;
+	CoinPackedVector elts;
 	if (ctx.assignedScenario(scen)) {
-
 		vector<double> elems(Wcol[scen]->getMinorDim(),0);
-		CoinPackedVector elts;
 		elts.setFullNonZero(elems.size(),&elems[0]);
+	}
+	return addSecondStageColumn(scen,elts,lb,ub,cobj);
+}
+
+int BAData::addSecondStageColumn(int scen, const CoinPackedVectorBase &elts, double lb, double ub, double cobj){
+
+	assert(scen >= 0 && scen < dims.numScenarios());
+	int returnIndex= -1;
+	if (ctx.assignedScenario(scen)) {
 
 		//Assertions
 		assert(lb<=ub);
@@ -1045,38 +1123,52 @@ void BAData::deleteLastSecondStageConsecutiveColumns(int scen, int nCols){
 
 	assert(scen >= 0 && scen < dims.numScenarios());
 
+	vector<int> indices;
 	if (ctx.assignedScenario(scen)) {
-
 		int nvar2 = dims.inner.numSecondStageVars(scen);
-		int ncons2 = dims.numSecondStageCons(scen);
 		//TODO add guard to make sure we don't delete a column that still has nonzero coefficients in the constraint matrix
 		assert(nCols<=nvar2);
+		for (int i=nvar2-nCols; i<nvar2;i++)indices.push_back(i);
+	}
+	deleteSecondStageColumns(scen,indices);
 
-		int colStart=dims.inner.numSecondStageVars(scen)-nCols;
+}
 
-		vector<int> indices(nCols);
-		for (int i=0; i<indices.size();i++)indices[i]=colStart+i;
+void BAData::deleteSecondStageColumns(int scen, const std::vector<int> &cols){
 
-		Wcol[scen]->deleteCols(nCols,&indices[0]);
-		Wrow[scen]->reverseOrderedCopyOf(*Wcol[scen]);
+	assert(scen >= 0 && scen < dims.numScenarios());
 
-		//Shrink l, u, and c
-		denseVector newL(nvar2+ncons2-nCols);
-		denseVector &oldL = l.getSecondStageVec(scen);
-		newL.copyBeginning(&oldL[0],nvar2-nCols);
-		newL.copyToPosition(&oldL[nvar2],nvar2-nCols,ncons2);
-		oldL.swap(newL);
+	if (ctx.assignedScenario(scen)) {
 
-		denseVector newU(nvar2+ncons2-nCols);
-		denseVector &oldU = u.getSecondStageVec(scen);
-		newU.copyBeginning(&oldU[0],nvar2-nCols);
-		newU.copyToPosition(&oldU[nvar2],nvar2-nCols,ncons2);
-		oldU.swap(newU);
+		int nvar2 = dims.inner.numSecondStageVars(scen);
+		int ncons2 = dims.numSecondStageCons(scen);
+		int nCols = cols.size();
+		assert(nCols<=nvar2);
 
-		denseVector newC(nvar2+ncons2-nCols);
+		if (nCols) {
+			Wcol[scen]->deleteCols(nCols,&cols[0]);
+			Wrow[scen]->reverseOrderedCopyOf(*Wcol[scen]);
+		}
+
+		//Shrink l, u, and c, keeping the slacks at the end
+		denseVector newL(nvar2+ncons2-nCols), newU(nvar2+ncons2-nCols), newC(nvar2+ncons2-nCols);
+		denseVector &oldL = l.getSecondStageVec(scen);
+		denseVector &oldU = u.getSecondStageVec(scen);
 		denseVector &oldC = c.getSecondStageVec(scen);
-		newC.copyBeginning(&oldC[0],nvar2-nCols);
-		newC.copyToPosition(&oldC[nvar2],nvar2-nCols,ncons2);
+		int pos = 0, next = 0;
+		for (int i = 0; i < nvar2+ncons2; i++) {
+			if (next < nCols && cols[next] == i) {
+				assert(next == 0 || cols[next-1] < i);
+				next++;
+				continue;
+			}
+			newL[pos] = oldL[i];
+			newU[pos] = oldU[i];
+			newC[pos++] = oldC[i];
+		}
+		assert(next == nCols);
+		oldL.swap(newL);
+		oldU.swap(newU);
 		oldC.swap(newC);
 
 		assert(oldU.length() == nvar2+ncons2-nCols);
@@ -1085,6 +1177,7 @@ void BAData::deleteLastSecondStageConsecutiveColumns(int scen, int nCols){
 		//Update dims
 		for (int i=0; i< nCols; i++)dims.inner.removeSecondStageVar(scen);
 
+		assert(l.getSecondStageVec(scen).length()==u.getSecondStageVec(scen).length());
 	}
 	//check constraint type?
 	vartype.deallocate();
@@ -1095,8 +1188,6 @@ void BAData::deleteLastSecondStageConsecutiveColumns(int scen, int nCols){
 	// TODO: fix this
 	names.allocate(dims, ctx, PrimalVector);
 
-	assert(l.getSecondStageVec(scen).length()==u.getSecondStageVec(scen).length());
-
 	const vector<int> &localScen = ctx.localScenarios();
 	for (unsigned i = 0; i < localScen.size(); i++) {
 		int scen = localScen[i];
@@ -44,6 +44,9 @@ public:
 
 	int addSecondStageColumn(int scen,double lb, double ub, double cobj);
 
+	// column with the entries elts in W
+	int addSecondStageColumn(int scen, const CoinPackedVectorBase &elts, double lb, double ub, double cobj);
+
 	void deleteLastFirstStageRows(int nRows);
 
 	void deleteLastFirstStageColumns(int nCols);
@@ -52,6 +55,9 @@ public:
 
 	void deleteLastSecondStageConsecutiveColumns(int scenario, int nCols);
 
+	// delete the columns cols (in increasing order) of a scenario
+	void deleteSecondStageColumns(int scenario, const std::vector<int> &cols);
+
 
 	const CoinShallowPackedVector retrieveARow(int index) const;
 
@@ -9,7 +9,7 @@
 
 using namespace std;
 
-BALPSolverBase::BALPSolverBase(const BAData &data) : nIter(0), startTime(0.0), data(data), status(Uninitialized),
+BALPSolverBase::BALPSolverBase(const BAData &data) : nIter(0), startTime(0.0), data(data), status(Uninitialized), keepEdgeWeights(false),
 	dualTol(1.0e-7), primalTol(1.0e-7), zeroTol(1.0e-12), primalRelTol(1.0e-9), pivotTol(5.0e-7),
 	phase1(false), doreport(false), reportFrequency(10000000), dumpEvery(0),
 	replaceFirst(0), firstReplaceSecond(0), secondReplaceFirst(0), replaceSecondSelf(0), 
@@ -247,6 +247,27 @@ void BALPSolverBase::initialize(bool reinvert) {
 
 }
 
+void BALPSolverBase::warmStart(bool keepWeights) {
+	assert(hasFactorization());
+	reloadData();
+	initialize(false);
+	keepEdgeWeights = keepWeights;
+}
+
+void BALPSolverBase::takeFactorization(BALPSolverBase &other) {
+	assert(other.hasFactorization());
+	std::swap(la, other.la);
+	// positions in basicIdx must match the columns of the factorization
+	states = other.states;
+	basicIdx = other.basicIdx;
+	nIter = other.nIter;
+	lastReinvert = other.lastReinvert;
+	lastGoodReinvert = other.lastGoodReinvert;
+	lastBadReinvert = other.lastBadReinvert;
+	status = Initialized;
+	other.status = LoadedFromFile;
+}
+
 void BALPSolverBase::setStates(const BAFlagVector<variableState> &state) {
 
 	assert(states.getFirstStageVec().length() == data.dims.numFirstStageVars());
@@ -53,6 +53,17 @@ public:
 
 	void setReinversionFrequency(int r) { reinvertFrequency = reinvertFrequency_backup = r; }
 
+	// true once the basis has been factorized
+	bool hasFactorization() const { return status != Uninitialized && status != LoadedFromFile; }
+	// restart after changes to the bounds or the objective only:
+	// the basis, its factorization and the eta file are kept and the
+	// iterates are recomputed from them without reinverting.
+	// the edge weights of the previous solve are reused if keepWeights.
+	void warmStart(bool keepWeights = true);
+	// take over the basis and the factorization of another solver of
+	// the same problem; other is left without a factorization
+	void takeFactorization(BALPSolverBase &other);
+
 	// will dump current status every d iterations. zero to disable.
 	void setDumpFrequency(int d, const std::string &outputname) { dumpEvery = d; outputName = outputname; }
 
@@ -75,6 +86,11 @@ protected:
 	// reinvert basis, initialize vectors, etc
 	void initialize(bool reinvert = true);
 
+	// refresh the working copies of the data (perturbed bounds or
+	// objective) before a warm start
+	virtual void reloadData() {}
+	bool keepEdgeWeights; // set by warmStart, consumed by go()
+
 	// dual has perturbed objective and primal has perturbed
 	// LB and UB, so let these be overridden.
 	virtual const denseBAVector & myObjective() const { return data.c; }
@@ -10,7 +10,6 @@ using namespace std;
 
 // structs for MPI
 struct doubledouble { double d1,d2; };
-struct doubleint { double d; int i;};
 
 BALPSolverDual::BALPSolverDual(const BAData &data) : BALPSolverBase(data), DSEPricing(true),
 	didperturb(false)
@@ -164,7 +163,34 @@ void BALPSolverDual::initializeIndexedInfeasibilities() {
 }
 
 
-BAIndex BALPSolverDual::price() const {
+// delta of the leaving variable given its (basic) index, also returns the
+// global index and the bound that is violated. only for assigned scenarios
+double BALPSolverDual::leavingDelta(BAIndex leave, BAIndex &leaveGlobal, infeasType &leaveType) const {
+	assert(data.ctx.assignedScenario(leave.scen));
+	int leaveIdx = basicIdx.getVec(leave.scen)[leave.idx];
+	assert(leaveIdx < data.dims.numVars(leave.scen));
+	leaveGlobal.scen = leave.scen;
+	leaveGlobal.idx = leaveIdx;
+	leaveType = checkInfeas(leaveGlobal);
+	if (leaveType == NotInfeasible) {
+		if (data.vartype[leaveGlobal] == Fixed) {
+			leaveType = Below;
+		} else {
+			assert(0);
+		}
+	}
+	double delta;
+	if (leaveType == Below) {
+		delta = x[leaveGlobal] - data.l[leaveGlobal];
+		assert(delta < 0.0);
+	} else {
+		delta = x[leaveGlobal] - data.u[leaveGlobal];
+		assert(delta > 0.0);
+	}
+	return delta;
+}
+
+BAIndex BALPSolverDual::price(double &delta) const {
 
 	const vector<int> &localScen = primalInfeas.localScenarios();
 
@@ -201,16 +227,19 @@ BAIndex BALPSolverDual::price() const {
 			}
 		}
 	}
-	doubleint my = { rmax, data.ctx.mype() }, best;
-	MPI_Allreduce(&my,&best,1,MPI_DOUBLE_INT,MPI_MAXLOC,data.ctx.comm());
-	MPI_Bcast(&maxidx,1,MPI_2INT,best.i,data.ctx.comm());
-
-	// could also bcast delta here to save a communication
+	// delta travels with the index of the leaving variable
+	double aux = 0.0;
+	if (maxidx.idx != -1) {
+		BAIndex leaveGlobal; infeasType leaveType;
+		aux = leavingDelta(maxidx, leaveGlobal, leaveType);
+	}
+	BAMaxLoc best = data.ctx.maxloc(rmax, maxidx, &aux, 1);
+	delta = best.aux[0];
 
-	return maxidx;
+	return best.idx;
 }
 
-BAIndex BALPSolverDual::ratioHarris(const sparseBAVector& alpha2, double delta0) {
+BAIndex BALPSolverDual::ratioHarris(const sparseBAVector& alpha2, double delta0, double &alphaq, double &dq) {
 	
 	const vector<int> &localScen = primalInfeas.localScenarios();
 	BAContainer<vector<int> > &Q = infeasList;
@@ -294,14 +323,9 @@ BAIndex BALPSolverDual::ratioHarris(const sparseBAVector& alpha2, double delta0)
 			}*/
 		}
 	}
-	doubleint my = {maxAlpha, data.ctx.mype()}, best;
-	MPI_Allreduce(&my,&best,1,MPI_DOUBLE_INT,MPI_MAXLOC,data.ctx.comm());
-	MPI_Bcast(&enter,1,MPI_2INT,best.i,data.ctx.comm());
+	return selectEntering(maxAlpha, enter, alpha2, alphaq, dq);
 	
 
-	//printf("return normally: %d %d (qsize %d, thetaMax %e)\n", enter.scen, enter.idx,qsize,thetaMax);
-	return enter;
-
 }
 
 
@@ -317,8 +341,8 @@ struct ratioDeltaPair {
 		bool operator<(const ratioDeltaPair &p) const { return (ratio < p.ratio); }
 		double ratio, delta;
 };
-BAIndex BALPSolverDual::ratioBFRT(const sparseBAVector& alpha2, double delta0) {
-	if (delta0 <= 1e-3) return ratioHarris(alpha2,delta0);
+BAIndex BALPSolverDual::ratioBFRT(const sparseBAVector& alpha2, double delta0, double &alphaq, double &dq) {
+	if (delta0 <= 1e-3) return ratioHarris(alpha2,delta0,alphaq,dq);
 	
 	const vector<int> &localScen = primalInfeas.localScenarios();
 	BAContainer<vector<int> > Q(data.dims,data.ctx, PrimalVector);
@@ -527,11 +551,23 @@ BAIndex BALPSolverDual::ratioBFRT(const sparseBAVector& alpha2, double delta0) {
 			}
 		}
 	}
-	doubleint my = { maxAlpha, data.ctx.mype() }, best;
-	MPI_Allreduce(&my,&best,1,MPI_DOUBLE_INT,MPI_MAXLOC,data.ctx.comm());
-	MPI_Bcast(&enter,1,MPI_2INT,best.i,data.ctx.comm());
+	return selectEntering(maxAlpha, enter, alpha2, alphaq, dq);
+}
 
-	return enter;
+// final step of the ratio tests: global choice of the entering variable
+// among the local candidates, alpha and d of the winner come with it
+BAIndex BALPSolverDual::selectEntering(double maxAlpha, BAIndex enter, const sparseBAVector& alpha2,
+	double &alphaq, double &dq) const {
+	double aux[2] = { 0.0, 0.0 };
+	if (enter.idx != -1) {
+		aux[0] = alpha2.getVec(enter.scen).v.denseVector()[enter.idx];
+		aux[1] = d[enter];
+	}
+	BAMaxLoc best = data.ctx.maxloc(maxAlpha, enter, aux, 2);
+	alphaq = best.aux[0];
+	dq = best.aux[1];
+
+	return best.idx;
 }
 
 
@@ -570,34 +606,17 @@ void BALPSolverDual::iterate() {
 	}
 
 	double t = MPI_Wtime();
-	BAIndex leave = price();
+	double delta;
+	BAIndex leave = price(delta);
 	selectLeavingTime += MPI_Wtime() - t;
 	// global index of leaving variable
 	BAIndex leaveGlobal;
 	leaveGlobal.scen = leave.scen;
 	leaveGlobal.idx = -1; // dummy value
-	double delta;
 	infeasType leaveType = Below; // dummy value
 	if (data.ctx.assignedScenario(leave.scen)) {
-		int leaveIdx = basicIdx.getVec(leave.scen)[leave.idx];
-		assert(leaveIdx < data.dims.numVars(leave.scen));
 		// only assigned proc needs global index and leaveType
-		leaveGlobal.idx = leaveIdx;
-		leaveType = checkInfeas(leaveGlobal);
-		if (leaveType == NotInfeasible) {
-			if (data.vartype[leaveGlobal] == Fixed) {
-				leaveType = Below;
-			} else {
-				assert(0);
-			}
-		}
-		if (leaveType == Below) {
-			delta = x[leaveGlobal] - data.l[leaveGlobal];
-			assert(delta < 0.0);
-		} else {
-			delta = x[leaveGlobal] - data.u[leaveGlobal];
-			assert(delta > 0.0);
-		}
+		leavingDelta(leave, leaveGlobal, leaveType);
 		if (data.ctx.owner(leave.scen) == data.ctx.mype() && doreport) {
 		  PIPS_ALG_LOG_SEV(info)<<boost::format("Selected %d,%d (%s) to leave (current: %e, delta: %e)") 
 		    % leaveGlobal.scen % leaveGlobal.idx % data.names[leaveGlobal].c_str() % x[leaveGlobal],delta;
@@ -609,8 +628,6 @@ void BALPSolverDual::iterate() {
 		}
 
 	}
-	if (leave.scen != -1) MPI_Bcast(&delta,1,MPI_DOUBLE,data.ctx.owner(leave.scen),data.ctx.comm());
-
 
 	// BTRAN
 	sparseBAVector &rho = btranVec;
@@ -642,9 +659,11 @@ void BALPSolverDual::iterate() {
 
 	double absdelta = abs(delta);
 	t = MPI_Wtime();
-	BAIndex enterIdx = ratioHarris(alpha,absdelta);
+	// entries of alpha and d for the entering variable
+	double alphaq, dq;
+	BAIndex enterIdx = ratioHarris(alpha,absdelta,alphaq,dq);
 	selectEnteringTime += MPI_Wtime() - t;
-	//BAIndex enterIdx = ratioBFRT(alpha,absdelta);
+	//BAIndex enterIdx = ratioBFRT(alpha,absdelta,alphaq,dq);
 	if (enterIdx.idx == -1) {
 		status = ProvenInfeasible; // dual unbounded
 		return;
@@ -681,25 +700,30 @@ void BALPSolverDual::iterate() {
 	// broadcast thetad?
 
 	// EXPAND (section 6.2.2.3)
+	// every process has alphaq and dq, so there is no need to broadcast
+	// thetad and the pivot
 	double thetad, btranPivot;
+	bool expand = (dq/alphaq < 0);
+	if (expand) {
+		if (delta < 0.0) {
+			thetad = -1.0e-12;
+		} else {
+			thetad = 1.0e-12;
+		}
+	} else {
+		if (delta < 0.0)
+			thetad = -dq/alphaq;
+		else
+			thetad = dq/alphaq;
+	}
 	if (data.ctx.assignedScenario(enterIdx.scen)) {
-		if (d[enterIdx]/alpha[enterIdx] < 0) {
+		if (expand) {
 			didperturb = true;
-			if (delta < 0.0) {
-				thetad = -1.0e-12;
-			} else {
-				thetad = 1.0e-12;
-			}
 			double diff = thetad*alpha[enterIdx] - d[enterIdx];
 			d[enterIdx] = thetad*alpha[enterIdx];
 			cPerturb[enterIdx] += diff;
 			if (doreport && data.ctx.mype() == data.ctx.owner(enterIdx.scen)) 
 			  PIPS_ALG_LOG_SEV(info) << "did EXPAND";
-		} else {
-			if (delta < 0.0)
-				thetad = -d[enterIdx]/alpha[enterIdx];
-			else
-				thetad = d[enterIdx]/alpha[enterIdx];
 		}
 		if (doreport && data.ctx.mype() == data.ctx.owner(enterIdx.scen)) {
 		  PIPS_ALG_LOG_SEV(info)<<boost::format("Selected %d,%d (%s) to enter (d: %e, alpha: %e)")
@@ -707,19 +731,7 @@ void BALPSolverDual::iterate() {
 		}
 	}
 	if (delta < 0.0) alpha.negate(); // get alpha back
-
-	if (enterIdx.scen != -1) {
-		doubledouble dd;
-		if (data.ctx.mype() == data.ctx.owner(enterIdx.scen)) {
-			dd.d1 = alpha[enterIdx];
-			dd.d2 = thetad;
-		}
-		MPI_Bcast(&dd,sizeof(doubledouble),MPI_BYTE,data.ctx.owner(enterIdx.scen),data.ctx.comm());
-		btranPivot = dd.d1;
-		thetad = dd.d2;
-	} else {
-		btranPivot = alpha[enterIdx];
-	}
+	btranPivot = (delta < 0.0) ? -alphaq : alphaq;
 	
 	// basis change and update
 	t = MPI_Wtime();
@@ -964,6 +976,10 @@ void BALPSolverDual::updateDSE(sparseBAVector &rho, const sparseBAVector &aq, BA
 
 void BALPSolverDual::go() {
 	//doreport = true;
+	// after a warm start that is still dual feasible, the basis is unchanged
+	// and the DSE weights of the previous solve are still valid
+	bool keepWeights = keepEdgeWeights && status != Initialized;
+	keepEdgeWeights = false;
 	if (status == Uninitialized) {
 		startTime = MPI_Wtime();
 		setSlackBasis();
@@ -981,7 +997,7 @@ void BALPSolverDual::go() {
 	
 	if (status == DualFeasible) {
 		//if (DSEPricing) initializeDSE(!basischange && slackbasis);
-		if (DSEPricing) initializeDSE(true);
+		if (DSEPricing && !keepWeights) initializeDSE(true);
 		for (; nIter < 100000000; nIter++) {
 			//if (nIter % reportFrequency == 0) doreport = 1;
 			if (phase1) {
@@ -14,7 +14,8 @@ public:
 	void iterate();
 
 	// use DSE prices if priceDSE, returns (basic) index of leaving variable
-	BAIndex price() const;
+	// and its primal infeasibility delta
+	BAIndex price(double &delta) const;
 
 
 
@@ -46,9 +47,14 @@ protected:
 	void updateDuals(const sparseBAVector &alpha, BAIndex leaveIdx, BAIndex enterIdx, const double thetad);
 	void updatePrimals(const sparseBAVector &aq, BAIndex enterIdx, BAIndex enter, BAIndex leave, double thetap);
 
+	double leavingDelta(BAIndex leave, BAIndex &leaveGlobal, infeasType &leaveType) const;
+
 	// bound-flipping ratio test.
-	BAIndex ratioBFRT(const sparseBAVector &alpha2, double delta0);
-	BAIndex ratioHarris(const sparseBAVector &alpha2, double delta0);
+	// the ratio tests also return alpha2 and d of the entering variable
+	BAIndex ratioBFRT(const sparseBAVector &alpha2, double delta0, double &alphaq, double &dq);
+	BAIndex ratioHarris(const sparseBAVector &alpha2, double delta0, double &alphaq, double &dq);
+	BAIndex selectEntering(double maxAlpha, BAIndex enter, const sparseBAVector &alpha2,
+		double &alphaq, double &dq) const;
 
 	void forceDualFeasible(); // add perturbations to objective to force dual feasibility
 
@@ -65,6 +71,7 @@ protected:
 
 	
 	virtual const denseBAVector & myObjective() const { return cPerturb; }
+	virtual void reloadData() { cPerturb.copyFrom(data.c); didperturb = false; }
 
 // indicates variable is actually feasible
 #define FEASIBLE_TINY 1e-100
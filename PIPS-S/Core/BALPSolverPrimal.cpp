@@ -11,7 +11,6 @@ using namespace std;
 
 // structs for MPI
 struct doubledouble { double d1,d2; };
-struct doubleint { double d; int i;};
 
 BALPSolverPrimal::BALPSolverPrimal(const BAData &data) : BALPSolverBase(data),
 	didperturb(false), devexPricing(true)
@@ -118,11 +117,7 @@ BAIndex BALPSolverPrimal::price() const {
 			}
 		}
 	}
-	doubleint my = { rmax, data.ctx.mype() }, best;
-	MPI_Allreduce(&my,&best,1,MPI_DOUBLE_INT,MPI_MAXLOC,data.ctx.comm());
-	MPI_Bcast(&maxidx,1,MPI_2INT,best.i,data.ctx.comm());
-
-	return maxidx;
+	return data.ctx.maxloc(rmax, maxidx).idx;
 }
 
 // Harris's two-pass ratio test
@@ -216,12 +211,7 @@ template <infeasType enterType> BAIndex BALPSolverPrimal::ratioHarris(const spar
 			}
 		}
 	}
-	doubleint my = {maxAlpha, data.ctx.mype()}, best;
-	MPI_Allreduce(&my,&best,1,MPI_DOUBLE_INT,MPI_MAXLOC,data.ctx.comm());
-	MPI_Bcast(&enter,1,MPI_2INT,best.i,data.ctx.comm());
-	
-
-	return enter;
+	return data.ctx.maxloc(maxAlpha, enter).idx;
 
 }
 
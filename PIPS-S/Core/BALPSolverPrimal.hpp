@@ -66,6 +66,7 @@ protected:
 
 	virtual const denseBAVector & myLB() const { return lPerturb; }
 	virtual const denseBAVector & myUB() const { return uPerturb; }
+	virtual void reloadData() { lPerturb.copyFrom(data.l); uPerturb.copyFrom(data.u); didperturb = false; }
 
 // indicates variable is actually feasible
 #define FEASIBLE_TINY 1e-100
@@ -89,17 +89,22 @@ void BALinearAlgebra::reinvert(const BAFlagVector<variableState> &v) {
 	tmp_t = MPI_Wtime();
 #endif
 	rowsPerProc.resize(data.ctx.nprocs());
+	rowsDispl.resize(data.ctx.nprocs());
 	MPI_Allgather(&rowsFromThis,1,MPI_INT,&rowsPerProc[0],1,MPI_INT,data.ctx.comm());
-	maxRowsIn = 0; rowsIn = 0;
+	rowsIn = 0;
 	for (int i = 0; i < data.ctx.nprocs(); i++) {
-		maxRowsIn = max(maxRowsIn, rowsPerProc[i]);
-		if (i == data.ctx.mype()) myOffset = rowsIn;
+		rowsDispl[i] = rowsIn;
 		rowsIn += rowsPerProc[i];
 	}
+	myOffset = rowsDispl[data.ctx.mype()];
 	assert(rowsIn + data.dims.numFirstStageCons() == nbasic1);
 	assert(rowsFromThis == rowsPerProc[data.ctx.mype()]);
-	ftranRecv.resize(maxRowsIn*data.ctx.nprocs());
-	ftranSend.resize(maxRowsIn);
+	// +1 so that &v[0] is valid when a process has no rows
+	ftranRecv.resize(rowsIn+1);
+	ftranSend.resize(rowsFromThis+1);
+	ftranPacked.resize(2*rowsFromThis+2);
+	packedCount.resize(data.ctx.nprocs());
+	packedDispl.resize(data.ctx.nprocs());
 	btranSend.resize(nbasic1);
 
 	reinvertFirstStage(basicCols1);
@@ -158,42 +163,27 @@ void BALinearAlgebra::reinvertFirstStage(const vector<int>& basicCols1) {
 	
 	int nMyElements = myElements.size();
 	// gather rows from each MPI process
-	vector<int> elementsCount(data.ctx.nprocs());
+	vector<int> elementsCount(data.ctx.nprocs()), elementsDispl(data.ctx.nprocs());
 	MPI_Allgather(&nMyElements,1,MPI_INT,&elementsCount[0],1,MPI_INT,data.ctx.comm());
 	CoinBigIndex nElements = 0;
-	int maxsize = 0;
 	for (int i = 0; i < data.ctx.nprocs(); i++) {
+		elementsDispl[i] = nElements;
 		nElements += elementsCount[i];
-		maxsize = max(elementsCount[i],maxsize);
 		//if (data.ctx.mype() == 0) printf("%d has %d elements\n",i,elementsCount[i]);
 	}
-	// pad so we don't read out of bounds (Allgather is faster than Allgatherv)
-	myElements.reserve(maxsize); myIndicesColumn.reserve(maxsize); myIndicesRow.reserve(maxsize);
-	double *recvElts = new double[maxsize*data.ctx.nprocs()];
-	int *recvIdxRow = new int[maxsize*data.ctx.nprocs()];
-	int *recvIdxCol = new int[maxsize*data.ctx.nprocs()];
-
-	MPI_Allgather(&myElements[0],maxsize,MPI_DOUBLE,recvElts,maxsize,MPI_DOUBLE,data.ctx.comm());	
-	MPI_Allgather(&myIndicesColumn[0],maxsize,MPI_INT,recvIdxCol,maxsize,MPI_INT,data.ctx.comm());	
-	MPI_Allgather(&myIndicesRow[0],maxsize,MPI_INT,recvIdxRow,maxsize,MPI_INT,data.ctx.comm());
-
-	myElements.clear(); myIndicesColumn.clear(); myIndicesRow.clear();
+	// keep &v[0] valid for processes without elements
+	myElements.reserve(1); myIndicesColumn.reserve(1); myIndicesRow.reserve(1);
 	allElements.reserve(nElements+1000); allElements.resize(nElements);
 	allIndicesRow.reserve(nElements+1000); allIndicesRow.resize(nElements);
 	allIndicesColumn.reserve(nElements+1000); allIndicesColumn.resize(nElements);
 
-	CoinBigIndex nEltSoFar = 0;
-	for (int i = 0; i < data.ctx.nprocs(); i++) {
-		// note assumption of assignment of scenarios, that they're in increasing order wrt procs
-		std::copy(recvElts+i*maxsize,recvElts+i*maxsize+elementsCount[i],&allElements[nEltSoFar]);
-		std::copy(recvIdxRow+i*maxsize,recvIdxRow+i*maxsize+elementsCount[i],&allIndicesRow[nEltSoFar]);
-		std::copy(recvIdxCol+i*maxsize,recvIdxCol+i*maxsize+elementsCount[i],&allIndicesColumn[nEltSoFar]);
-		nEltSoFar += elementsCount[i];
-	}
-	
-	delete [] recvElts;
-	delete [] recvIdxRow;
-	delete [] recvIdxCol;
+	// exact sizes, received in place;
+	// note assumption of assignment of scenarios, that they're in increasing order wrt procs
+	MPI_Allgatherv(&myElements[0],nMyElements,MPI_DOUBLE,&allElements[0],&elementsCount[0],&elementsDispl[0],MPI_DOUBLE,data.ctx.comm());
+	MPI_Allgatherv(&myIndicesColumn[0],nMyElements,MPI_INT,&allIndicesColumn[0],&elementsCount[0],&elementsDispl[0],MPI_INT,data.ctx.comm());
+	MPI_Allgatherv(&myIndicesRow[0],nMyElements,MPI_INT,&allIndicesRow[0],&elementsCount[0],&elementsDispl[0],MPI_INT,data.ctx.comm());
+
+	myElements.clear(); myIndicesColumn.clear(); myIndicesRow.clear();
 
 	// now columns of A matrix
 	const double *Aelts = data.Acol->getElements();
@@ -242,8 +232,9 @@ void BALinearAlgebra::ftran(sparseBAVector &v) {
 
 	const vector<int> &localScen = v.localScenarios();
 	// see notes
-	// step 1, FTRAN-G and pack Z_ir_i values
-	int rowsSoFar = 0;
+	// step 1, FTRAN-G and pack the nonzero Z_ir_i values as (row, value)
+	int rowsSoFar = 0, nPacked = 0;
+	double *packed = &ftranPacked[0];
 	for (unsigned j = 1; j < localScen.size(); j++) {
 		int i = localScen[j];
 		CoinIndexedVector &region = regions[i];
@@ -254,35 +245,68 @@ void BALinearAlgebra::ftran(sparseBAVector &v) {
 		
 		if (v2.getNumElements() != 0) { 
 			f[i]->updateColumnG(&region,&v2);
-			std::copy(region.denseVector()+nbasic2,region.denseVector()+nrows2,&ftranSend[rowsSoFar]);
-		} else {
-			std::fill(&ftranSend[rowsSoFar],&ftranSend[rowsSoFar+nRowsFromThis],0.0);
+			const double *regionElts = region.denseVector();
+			const int *regionIdx = region.getIndices();
+			int nnzRegion = region.getNumElements();
+			for (int k = 0; k < nnzRegion; k++) {
+				int row = regionIdx[k];
+				if (row >= nbasic2 && regionElts[row]) {
+					packed[2*nPacked] = row-nbasic2+rowsSoFar;
+					packed[2*nPacked+1] = regionElts[row];
+					nPacked++;
+				}
+			}
 		}
 		rowsSoFar += nRowsFromThis;
 	}
 
-
-
-	// collect Z_ir_i values
-	MPI_Allgather(&ftranSend[0],maxRowsIn,MPI_DOUBLE,&ftranRecv[0],maxRowsIn,MPI_DOUBLE,data.ctx.comm());
-
-	// unpack Z_ir_i values
+	// collect Z_ir_i values; when few are nonzero over all processes,
+	// only the packed pairs are sent
 	double *rhsElts = region1.denseVector();
 	int *rhsIdx = region1.getIndices();
 	int rhsNnz = 0;
-	rowsSoFar = 0;
-	for (int p = 0; p < data.ctx.nprocs(); p++) {
-		int nRowsFromThis = rowsPerProc[p];
-		for (int k = 0; k < nRowsFromThis; k++) {
-			double val = ftranRecv[p*maxRowsIn+k];
+	int nprocs = data.ctx.nprocs();
+	bool sparseComm = false;
+	if (rowsIn >= sparseFtranMinRows) {
+		MPI_Allgather(&nPacked,1,MPI_INT,&packedCount[0],1,MPI_INT,data.ctx.comm());
+		int totalPacked = 0;
+		for (int p = 0; p < nprocs; p++) {
+			packedCount[p] *= 2;
+			packedDispl[p] = totalPacked;
+			totalPacked += packedCount[p];
+		}
+		// a pair costs two doubles, a dense entry one
+		sparseComm = totalPacked < rowsIn;
+		if (sparseComm) {
+			MPI_Allgatherv(packed,2*nPacked,MPI_DOUBLE,&ftranRecv[0],&packedCount[0],&packedDispl[0],MPI_DOUBLE,data.ctx.comm());
+			for (int p = 0; p < nprocs; p++) {
+				const double *recv = &ftranRecv[packedDispl[p]];
+				for (int k = 0; k < packedCount[p]; k += 2) {
+					int inRow = rowsDispl[p]+static_cast<int>(recv[k]);
+					rhsElts[inRow] = recv[k+1];
+					rhsIdx[rhsNnz++] = inRow;
+				}
+			}
+		}
+	}
+	if (!sparseComm) {
+		int rowsFromThis = rowsPerProc[data.ctx.mype()];
+		std::fill(ftranSend.begin(),ftranSend.begin()+rowsFromThis,0.0);
+		for (int k = 0; k < nPacked; k++) {
+			ftranSend[static_cast<int>(packed[2*k])] = packed[2*k+1];
+		}
+		MPI_Allgatherv(&ftranSend[0],rowsFromThis,MPI_DOUBLE,&ftranRecv[0],&rowsPerProc[0],&rowsDispl[0],MPI_DOUBLE,data.ctx.comm());
+
+		// unpack Z_ir_i values
+		for (int inRow = 0; inRow < rowsIn; inRow++) {
+			double val = ftranRecv[inRow];
 			if (val) {
-				int inRow = rowsSoFar+k;
 				rhsElts[inRow] = val;
 				rhsIdx[rhsNnz++] = inRow;
 			}
 		}
-		rowsSoFar += nRowsFromThis;
 	}
+	rowsSoFar = rowsIn;
 
 	int nrows1 = data.dims.numFirstStageCons();
 
@@ -30,11 +30,16 @@ protected:
 	std::vector<double> myElements, allElements;
 	std::vector<int> myIndicesRow, allIndicesRow, myIndicesColumn, allIndicesColumn;
 	std::vector<int> rowsPerProc; // number of rows that come into the first stage from each process
+	std::vector<int> rowsDispl; // offset of each process's rows (for Allgatherv)
 	int rowsIn; // total number of rows that come into the first stage
-	int maxRowsIn; // max number of rows from any process (used for packing)
 	int myOffset; // row index where this process's scenarios start
 
-	std::vector<double> ftranSend, ftranRecv; // send recv buffers for Allgather during FTRAN
+	std::vector<double> ftranSend, ftranRecv; // send recv buffers for Allgatherv during FTRAN
+	// nonzeros of ftranSend packed as (local row, value) pairs, and their counts per process
+	std::vector<double> ftranPacked;
+	std::vector<int> packedCount, packedDispl;
+	// below this many incoming rows, FTRAN always sends dense values and skips the count exchange
+	static const int sparseFtranMinRows = 1000;
 	std::vector<double> btranSend;
 
 	std::vector<CoinIndexedVector> regions;
@@ -5,7 +5,7 @@
 
 using namespace std;
 
-PIPSSInterface::PIPSSInterface(stochasticInput &in, BAContext &ctx, solveType t) : d(in,ctx), boundsChanged(false), st(t) {
+PIPSSInterface::PIPSSInterface(stochasticInput &in, BAContext &ctx, solveType t) : d(in,ctx), boundsChanged(false), objChanged(false), st(t) {
 
 	if (t == usePrimal) {
 		solver = new BALPSolverPrimal(d);
@@ -24,7 +24,7 @@ PIPSSInterface::PIPSSInterface(stochasticInput &in, BAContext &ctx, solveType t)
 
 }
 
-PIPSSInterface::PIPSSInterface(const BAData& _d, solveType t) : d(_d), boundsChanged(false), st(t) {
+PIPSSInterface::PIPSSInterface(const BAData& _d, solveType t) : d(_d), boundsChanged(false), objChanged(false), st(t) {
 
 	if (t == usePrimal) {
 		solver = new BALPSolverPrimal(d);
@@ -43,18 +43,34 @@ void PIPSSInterface::go() {
 	double t = MPI_Wtime();
 	int mype = d.ctx.mype();
 
+	// only bounds or objective changed since the last solve: restart
+	// from the factorized basis instead of reinverting
+	bool warm = (boundsChanged || objChanged) && solver->hasFactorization();
+	bool keepWeights = true;
+
 	// Reallocate if bounds changed for primal solve, change to dual solve
 	if (boundsChanged && st == usePrimal) {
 		BALPSolverBase *solver2 = new BALPSolverDual(d);
-		solver2->setStates(solver->getStates());
+		if (warm) {
+			solver2->takeFactorization(*solver);
+			keepWeights = false; // primal has devex weights, not DSE
+		} else {
+			solver2->setStates(solver->getStates());
+		}
 		solver2->setPrimalTolerance(solver->getPrimalTolerance());
 		solver2->setDualTolerance(solver->getDualTolerance());
 		solver2->phase1 = solver->phase1;
 		delete solver;
 		solver = solver2;
-		boundsChanged = false;
 		st = useDual;
 	}
+	boundsChanged = false;
+	objChanged = false;
+
+	if (warm) {
+		if (mype == 0) PIPS_APP_LOG_SEV(info)<<"Warm start from the current factorization";
+		solver->warmStart(keepWeights);
+	}
 
 	solver->go();
 
@@ -225,6 +241,21 @@ void PIPSSInterface::setUB(const denseBAVector& ub) {
         boundsChanged = true;
 }
 
+void PIPSSInterface::setFirstStageColObj(int idx, double newObj) {
+	d.c.getFirstStageVec()[idx] = newObj;
+	objChanged = true;
+}
+
+void PIPSSInterface::setSecondStageColObj(int scen, int idx, double newObj) {
+	d.c.getSecondStageVec(scen)[idx] = newObj;
+	objChanged = true;
+}
+
+void PIPSSInterface::setObjective(const denseBAVector& c) {
+	d.c.copyFrom(c);
+	objChanged = true;
+}
+
 void PIPSSInterface::addRow(const std::vector<double>& elts1, const std::vector<double> &elts2, int scen, double lb, double ub) {
 
 	CoinPackedVector e1;
@@ -436,3 +467,98 @@ void PIPSSInterface::commitNewRows() {
 		int out= d.addSecondStageColumn(scen,lb,ub,cobj);
 		return out;
 	}
+
+	// colOrigin[scen][k] is the index of column k of scenario scen in the
+	// states of the current solver, or -1 for a column added since
+	void PIPSSInterface::trackSecondStageColumns(int scen){
+		if (colOrigin.size() == 0) colOrigin.resize(d.dims.numScenarios());
+		vector<int> &origin = colOrigin[scen];
+		if (origin.size() == 0) {
+			int nvar2 = d.dims.inner.numSecondStageVars(scen);
+			origin.resize(nvar2);
+			for (int k = 0; k < nvar2; k++) origin[k] = k;
+		}
+	}
+
+	int PIPSSInterface::addSecondStageColumn(int scen, const std::vector<double>& elts, double lb, double ub, double cobj){
+		CoinPackedVector e;
+		if (d.ctx.assignedScenario(scen)) {
+			trackSecondStageColumns(scen);
+			colOrigin[scen].push_back(-1);
+			e.setFullNonZero(elts.size(),&elts[0]);
+		}
+		return d.addSecondStageColumn(scen,e,lb,ub,cobj);
+	}
+
+	void PIPSSInterface::deleteSecondStageColumns(int scen, const std::vector<int> &cols){
+		if (d.ctx.assignedScenario(scen)) {
+			trackSecondStageColumns(scen);
+			vector<int> &origin = colOrigin[scen];
+			const denseFlagVector<variableState> &states = solver->states.getSecondStageVec(scen);
+			unsigned j = 0, next = 0;
+			for (unsigned k = 0; k < origin.size(); k++) {
+				if (j < cols.size() && cols[j] == (int)k) {
+					// deleting a basic column would leave the basis singular
+					assert(origin[k] < 0 || states[origin[k]] != Basic);
+					j++;
+				} else {
+					origin[next++] = origin[k];
+				}
+			}
+			assert(j == cols.size());
+			origin.resize(next);
+		}
+		d.deleteSecondStageColumns(scen,cols);
+	}
+
+	void PIPSSInterface::commitNewColumns(){
+		const vector<int> &localScen = d.ctx.localScenarios();
+
+		// nothing added or deleted (e.g., only objective coefficients
+		// changed): keep the solver, go() restarts from its factorization
+		int changed = 0;
+		for (unsigned i = 1; i < localScen.size(); i++) {
+			int scen = localScen[i];
+			int nvar2 = d.dims.inner.numSecondStageVars(scen);
+			int ncons2 = d.dims.numSecondStageCons(scen);
+			if ((colOrigin.size() && colOrigin[scen].size()) ||
+				solver->states.getSecondStageVec(scen).length() != nvar2 + ncons2) {
+				changed = 1;
+			}
+		}
+		MPI_Allreduce(MPI_IN_PLACE,&changed,1,MPI_INT,MPI_MAX,d.ctx.comm());
+		if (!changed) return;
+
+		BALPSolverPrimal* solver2 = new BALPSolverPrimal(d);
+		solver2->setPrimalTolerance(solver->getPrimalTolerance());
+		solver2->setDualTolerance(solver->getDualTolerance());
+
+		solver2->states.getFirstStageVec().copyFrom(solver->states.getFirstStageVec());
+		for (unsigned i = 1; i < localScen.size(); i++) {
+			int scen = localScen[i];
+
+			denseFlagVector<variableState> &oldStates = solver->states.getSecondStageVec(scen), &newStates = solver2->states.getSecondStageVec(scen);
+			int nvar2 = d.dims.inner.numSecondStageVars(scen);
+			int ncons2 = d.dims.numSecondStageCons(scen);
+			int oldnvar2 = oldStates.length() - ncons2;
+
+			// the basis stays primal feasible; new columns start nonbasic at their lower bound
+			if (colOrigin.size() && colOrigin[scen].size()) {
+				const vector<int> &origin = colOrigin[scen];
+				assert((int)origin.size() == nvar2);
+				for (int k = 0; k < nvar2; k++) {
+					newStates[k] = (origin[k] >= 0) ? oldStates[origin[k]] : AtLower;
+				}
+				colOrigin[scen].clear();
+			} else {
+				assert(nvar2 == oldnvar2);
+				copy(&oldStates[0],&oldStates[nvar2],&newStates[0]);
+			}
+			copy(&oldStates[oldnvar2],&oldStates[oldStates.length()],&newStates[nvar2]);
+		}
+
+		delete solver;
+		solver = solver2;
+		st = usePrimal;
+		commitStates();
+	}
@@ -68,6 +68,14 @@ public:
         void setLB(const denseBAVector& lb);
         void setUB(const denseBAVector& ub);
 
+	void setFirstStageColObj(int idx, double newObj);
+	void setSecondStageColObj(int scen, int idx, double newObj);
+	void setObjective(const denseBAVector& c);
+
+	// After changes to bounds and/or the objective only, go() restarts
+	// from the current basis and keeps its factorization (warm start).
+	// Use commitStates() or setStates() to force a reinversion.
+
         const denseBAVector& getLB() const { return solver->myLB(); }
         const denseBAVector& getUB() const { return solver->myUB(); }
 
@@ -116,6 +124,18 @@ public:
 
 	int addSecondStageColumn(int scen,double lb, double ub, double cobj);
 
+	// column of scenario scen with the (dense) entries elts in W
+	int addSecondStageColumn(int scen, const std::vector<double>& elts, double lb, double ub, double cobj);
+
+	// delete the nonbasic columns cols (in increasing order) of a scenario
+	void deleteSecondStageColumns(int scen, const std::vector<int> &cols);
+
+	// after adding and deleting second-stage columns, keep the basis
+	// (primal feasible, new columns nonbasic) for the primal simplex.
+	// The basis is reinverted on the next go(); nothing is done if no
+	// columns were added or deleted.
+	void commitNewColumns();
+
 	void deleteLastFirstStageConsecutiveRows(int nRows);
 
 	void deleteLastSecondStageConsecutiveRows(int scenario, int nRows);
@@ -136,9 +156,13 @@ protected:
 	BALPSolverBase *solver;
 
 	bool boundsChanged;
+	bool objChanged;
         solveType st;
 	BAData d;
 
+	void trackSecondStageColumns(int scen);
+	std::vector<std::vector<int> > colOrigin;
+
 friend class BALPSolverDual;
 
 };
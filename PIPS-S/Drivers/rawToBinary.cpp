@@ -0,0 +1,32 @@
+#include "rawInput.hpp"
+#include <cstdlib>
+
+using namespace std;
+
+// writes the binary scenario cache read by rawInput
+int main(int argc, char **argv) {
+
+	MPI_Init(&argc, &argv);
+
+	int mype;
+	MPI_Comm_rank(MPI_COMM_WORLD,&mype);
+
+	if (argc < 3) {
+		if (mype == 0) printf("Usage: %s [rawdump root name] [num scenarios]\n",argv[0]);
+		MPI_Finalize();
+		return 1;
+	}
+
+	string datarootname(argv[1]);
+	int nscen = atoi(argv[2]);
+
+	if (mype == 0) {
+		rawInput s(datarootname, nscen, MPI_COMM_SELF, false);
+		printf("Writing %d scenarios to %sbin\n", nscen, datarootname.c_str());
+		s.writeBinaryCache(datarootname + "bin");
+	}
+
+	MPI_Finalize();
+
+	return 0;
+}
@@ -1,6 +1,7 @@
 #include "ClpBALPInterface.hpp"
 #include <sstream>
 #include <fstream>
+#include <algorithm>
 
 using namespace std;
 
@@ -250,9 +251,7 @@ variableState ClpBALPInterface::getFirstStageRowState(int idx) const {
 }
 
 variableState ClpBALPInterface::getSecondStageColState(int scen, int idx) const {
-	int offset = dims.numFirstStageVars();
-	for (int i = 0; i < scen; i++) offset += dims.numSecondStageVars(i);
-	return clpStatusToState(model.getColumnStatus(offset+idx));
+	return clpStatusToState(model.getColumnStatus(secondStageColIndex(scen,idx)));
 }
 
 variableState ClpBALPInterface::getSecondStageRowState(int scen, int idx) const {
@@ -270,9 +269,7 @@ void ClpBALPInterface::setFirstStageRowState(int idx,variableState s) {
 }
 
 void ClpBALPInterface::setSecondStageColState(int scen, int idx,variableState s) {
-	int offset = dims.numFirstStageVars();
-	for (int i = 0; i < scen; i++) offset += dims.numSecondStageVars(i);
-	model.setColumnStatus(offset+idx,stateToClpStatus(s));
+	model.setColumnStatus(secondStageColIndex(scen,idx),stateToClpStatus(s));
 }
 
 void ClpBALPInterface::setSecondStageRowState(int scen, int idx,variableState s) {
@@ -290,11 +287,12 @@ vector<double> ClpBALPInterface::getFirstStagePrimalColSolution() const {
 
 vector<double> ClpBALPInterface::getSecondStagePrimalColSolution(int scen) const {
 	const double *sol = model.primalColumnSolution();
-	int offset = dims.numFirstStageVars();
-	for (int i = 0; i < scen; i++) {
-		offset += dims.numSecondStageVars(i);
+	int nvar2 = dims.numSecondStageVars(scen);
+	vector<double> out(nvar2);
+	for (int i = 0; i < nvar2; i++) {
+		out[i] = sol[secondStageColIndex(scen,i)];
 	}
-	return vector<double>(sol+offset,sol+offset+dims.numSecondStageVars(scen));
+	return out;
 }
 
 vector<double> ClpBALPInterface::getFirstStageDualColSolution() const {
@@ -305,11 +303,12 @@ vector<double> ClpBALPInterface::getFirstStageDualColSolution() const {
 
 vector<double> ClpBALPInterface::getSecondStageDualColSolution(int scen) const {
 	const double *sol = model.dualColumnSolution();
-	int offset = dims.numFirstStageVars();
-	for (int i = 0; i < scen; i++) {
-		offset += dims.numSecondStageVars(i);
+	int nvar2 = dims.numSecondStageVars(scen);
+	vector<double> out(nvar2);
+	for (int i = 0; i < nvar2; i++) {
+		out[i] = sol[secondStageColIndex(scen,i)];
 	}
-	return vector<double>(sol+offset,sol+offset+dims.numSecondStageVars(scen));
+	return out;
 }
 
 vector<double> ClpBALPInterface::getSecondStageDualRowSolution(int scen) const {
@@ -357,7 +356,6 @@ void ClpBALPInterface::writeStatus(const std::string &filebase) {
 
 	int nbasic = 0;
 	int roffset = ncons1;
-	int coffset = nvar1real;
 	for (int k = 0; k < nscen; k++) {
 		stringstream fname;
 		fname << filebase << k+1;
@@ -366,7 +364,7 @@ void ClpBALPInterface::writeStatus(const std::string &filebase) {
 		int nvar2real = dims.numSecondStageVars(k);
 		int ncons2 = dims.numSecondStageCons(k);
 		for (int i = 0; i < nvar2real; i++) {
-			int idx = i + coffset;
+			int idx = secondStageColIndex(k,i);
 			if (model.getColumnStatus(idx) == ClpSimplex::basic) {
 				nbasicThis++; nbasic++;
 			} else if (model.getColumnStatus(idx) == ClpSimplex::superBasic) {
@@ -399,7 +397,7 @@ void ClpBALPInterface::writeStatus(const std::string &filebase) {
 		}
 		f << nbasicThis << " BasisOnly\n";
 		for (int i = 0; i < nvar2real; i++) {
-			f << i << " " << statusString(model.getColumnStatus(i+coffset)) << "\n";	
+			f << i << " " << statusString(model.getColumnStatus(secondStageColIndex(k,i))) << "\n";	
 		}
 		for (int i = 0; i < ncons2; i++) {
 			f << i + nvar2real << " " << statusString(model.getRowStatus(i+roffset)) << "\n";
@@ -407,7 +405,6 @@ void ClpBALPInterface::writeStatus(const std::string &filebase) {
 
 		f.close();
 		roffset += ncons2;
-		coffset += nvar2real;
 	}
 	stringstream fname;
 	fname << filebase << 0;
@@ -477,7 +474,6 @@ void ClpBALPInterface::loadStatus(const std::string &filebase) {
 	int ncons1 = dims.numFirstStageCons();
 	
 	int roffset = ncons1;
-	int coffset = nvar1real;
 	string line;
 
 	for (int k = 0; k < nscen; k++) {
@@ -497,7 +493,7 @@ void ClpBALPInterface::loadStatus(const std::string &filebase) {
 			f >> r;
 			f >> status;
 			assert(r == i);
-			model.setColumnStatus(r+coffset, statusFromString(status));
+			model.setColumnStatus(secondStageColIndex(k,r), statusFromString(status));
 
 		}
 		for (int i = 0; i < ncons2; i++) {
@@ -509,7 +505,6 @@ void ClpBALPInterface::loadStatus(const std::string &filebase) {
 
 		f.close();
 		roffset += ncons2;
-		coffset += nvar2real;
 	}
 	stringstream fname;
 	fname << filebase << 0;
@@ -557,13 +552,10 @@ void ClpBALPInterface::addRow(const std::vector<double>& elts1, const std::vecto
 	int nvar2 = dims.numSecondStageVars(scen);
 	assert(elts2.size() == static_cast<unsigned>(nvar2));
 
-	int offset = nvar1;
-	for (int i = 0; i < scen; i++) offset += dims.numSecondStageVars(i);
-
 	for (int i = 0; i < nvar2; i++) {
 		if (elts2[i]) {
 			elts.push_back(elts2[i]);
-			idx.push_back(offset+i);
+			idx.push_back(secondStageColIndex(scen,i));
 		}
 	}
 
@@ -580,3 +572,89 @@ void ClpBALPInterface::setFirstStageColLB(int idx, double newLb) {
 void ClpBALPInterface::setFirstStageColUB(int idx, double newUb) {
 	model.setColUpper(idx, newUb);
 }
+
+void ClpBALPInterface::setFirstStageColObj(int idx, double newObj) {
+	model.setObjectiveCoefficient(idx, newObj);
+}
+
+void ClpBALPInterface::setSecondStageColObj(int scen, int idx, double newObj) {
+	model.setObjectiveCoefficient(secondStageColIndex(scen,idx), newObj);
+}
+
+int ClpBALPInterface::secondStageColIndex(int scen, int idx) const {
+	if (colIndex.size()) return colIndex[scen][idx];
+	int offset = dims.numFirstStageVars();
+	for (int i = 0; i < scen; i++) offset += dims.numSecondStageVars(i);
+	return offset+idx;
+}
+
+void ClpBALPInterface::mapSecondStageColumns() {
+	if (colIndex.size()) return;
+	int nscen = dims.numScenarios();
+	int offset = dims.numFirstStageVars();
+	colIndex.resize(nscen);
+	for (int scen = 0; scen < nscen; scen++) {
+		int nvar2 = dims.numSecondStageVars(scen);
+		colIndex[scen].resize(nvar2);
+		for (int i = 0; i < nvar2; i++) colIndex[scen][i] = offset++;
+	}
+}
+
+int ClpBALPInterface::addSecondStageColumn(int scen, const std::vector<double>& elts, double lb, double ub, double cobj) {
+	
+	int ncons2 = dims.numSecondStageCons(scen);
+	assert(elts.size() == static_cast<unsigned>(ncons2));
+
+	int offset = dims.numFirstStageCons();
+	for (int i = 0; i < scen; i++) offset += dims.numSecondStageCons(i);
+
+	vector<double> e;
+	vector<int> idx;
+	for (int i = 0; i < ncons2; i++) {
+		if (elts[i]) {
+			e.push_back(elts[i]);
+			idx.push_back(offset+i);
+		}
+	}
+
+	mapSecondStageColumns();
+	colIndex[scen].push_back(model.numberColumns());
+	// addColumn keeps the statuses of the other columns, the new one is at its lower bound
+	model.addColumn(e.size(),&idx[0],&e[0],lb,ub,cobj);
+	model.setColumnStatus(colIndex[scen].back(),ClpSimplex::atLowerBound);
+	dims.addSecondStageVar(scen);
+
+	return colIndex[scen].size()-1;
+}
+
+void ClpBALPInterface::deleteSecondStageColumns(int scen, const std::vector<int> &cols) {
+	
+	if (cols.empty()) return;
+	mapSecondStageColumns();
+
+	vector<int> &cidx = colIndex[scen];
+	vector<int> del(cols.size());
+	for (unsigned j = 0; j < cols.size(); j++) {
+		assert(j == 0 || cols[j-1] < cols[j]);
+		del[j] = cidx[cols[j]];
+	}
+	model.deleteColumns(del.size(),&del[0]);
+
+	unsigned next = 0, j = 0;
+	for (unsigned i = 0; i < cidx.size(); i++) {
+		if (j < cols.size() && cols[j] == (int)i) { j++; continue; }
+		cidx[next++] = cidx[i];
+	}
+	cidx.resize(next);
+	for (unsigned j = 0; j < cols.size(); j++) dims.removeSecondStageVar(scen);
+
+	// the columns after the deleted ones moved down
+	sort(del.begin(),del.end());
+	int nscen = dims.numScenarios();
+	for (int s = 0; s < nscen; s++) {
+		for (unsigned i = 0; i < colIndex[s].size(); i++) {
+			int c = colIndex[s][i];
+			colIndex[s][i] = c - (lower_bound(del.begin(),del.end(),c)-del.begin());
+		}
+	}
+}
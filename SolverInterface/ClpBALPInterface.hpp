@@ -48,9 +48,20 @@ public:
 	void addRow(const std::vector<double>& elts1, const std::vector<double> &elts2, int scen, double lb = -COIN_DBL_MAX, double ub = COIN_DBL_MAX);
 	void commitNewRows() {}
 
+	// second-stage column with the (dense) entries elts in W.
+	// Clp appends it after all the other columns.
+	int addSecondStageColumn(int scen, const std::vector<double>& elts, double lb, double ub, double cobj);
+	// delete the columns cols (in increasing order) of a scenario
+	void deleteSecondStageColumns(int scen, const std::vector<int> &cols);
+	// Clp warm starts from the column and row statuses it keeps
+	void commitNewColumns() {}
+
 	void setFirstStageColLB(int idx, double newLb);
 	void setFirstStageColUB(int idx, double newUb);
 
+	void setFirstStageColObj(int idx, double newObj);
+	void setSecondStageColObj(int scen, int idx, double newObj);
+
 
 	double primalError() { return model.largestPrimalError(); }
 
@@ -63,6 +74,13 @@ protected:
 
 	const BADimensions& getDims() const { return dims; }
 
+	// index in model of column idx of scenario scen
+	int secondStageColIndex(int scen, int idx) const;
+	// switch from contiguous scenario blocks to colIndex
+	void mapSecondStageColumns();
+	// empty while the columns of each scenario are contiguous
+	std::vector<std::vector<int> > colIndex;
+
 };
 
 